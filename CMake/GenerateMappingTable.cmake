@@ -0,0 +1,230 @@
+# Usage:
+# cmake -P GenerateMappingTable.cmake <path/to/mappings.h> <path/to/mapping_table.h.in> <path/to/mapping_table.h>
+
+cmake_policy(SET CMP0054 NEW)
+
+set(source_path "${CMAKE_ARGV3}")
+set(template_path "${CMAKE_ARGV4}")
+set(target_path "${CMAKE_ARGV5}")
+
+if (NOT EXISTS "${source_path}")
+    message(FATAL_ERROR "Failed to find mappings file ${source_path}")
+endif()
+
+if (NOT EXISTS "${template_path}")
+    message(FATAL_ERROR "Failed to find template file ${template_path}")
+endif()
+
+# These must match the _GLFW_JOYSTICK_* constants in input.c
+set(type_a 1)
+set(type_b 2)
+set(type_h 3)
+
+# These must match the GLFW_GAMEPAD_BUTTON_* and GLFW_GAMEPAD_AXIS_* tokens
+set(button_a 0)
+set(button_b 1)
+set(button_x 2)
+set(button_y 3)
+set(button_leftshoulder 4)
+set(button_rightshoulder 5)
+set(button_back 6)
+set(button_start 7)
+set(button_guide 8)
+set(button_leftstick 9)
+set(button_rightstick 10)
+set(button_dpup 11)
+set(button_dpright 12)
+set(button_dpdown 13)
+set(button_dpleft 14)
+set(axis_leftx 0)
+set(axis_lefty 1)
+set(axis_rightx 2)
+set(axis_righty 3)
+set(axis_lefttrigger 4)
+set(axis_righttrigger 5)
+
+# Parses an SDL_GameControllerDB line the same way as parseMapping in input.c
+# and sets the result variable to a _GLFWmapping initializer prefixed with the
+# final GUID, or to an empty string if the line was rejected
+function(parse_mapping line platform result)
+    set(${result} "" PARENT_SCOPE)
+
+    if (NOT line MATCHES "^([^,]*),([^,]*),(.*)$")
+        return()
+    endif()
+
+    set(guid "${CMAKE_MATCH_1}")
+    set(name "${CMAKE_MATCH_2}")
+    set(rest "${CMAKE_MATCH_3}")
+
+    string(LENGTH "${guid}" guid_length)
+    string(LENGTH "${name}" name_length)
+    if (NOT guid_length EQUAL 32 OR name_length GREATER 127)
+        return()
+    endif()
+
+    foreach(i RANGE 14)
+        set(button_${i} "0,0,0,0")
+    endforeach()
+    foreach(i RANGE 5)
+        set(axis_${i} "0,0,0,0")
+    endforeach()
+
+    string(REPLACE "," ";" fields "${rest}")
+    foreach(field ${fields})
+        if (field MATCHES "^[+-]")
+            return()
+        endif()
+
+        if (NOT field MATCHES "^([a-z]+):(.*)$")
+            continue()
+        endif()
+
+        set(key "${CMAKE_MATCH_1}")
+        set(value "${CMAKE_MATCH_2}")
+
+        if (key STREQUAL "platform")
+            string(FIND "${value}" "${platform}" position)
+            if (NOT position EQUAL 0)
+                return()
+            endif()
+            continue()
+        elseif (DEFINED button_${key})
+            set(element button_${button_${key}})
+        elseif (DEFINED axis_${key})
+            set(element axis_${axis_${key}})
+        else()
+            continue()
+        endif()
+
+        if (NOT value MATCHES "^([+-]?)([abh])([0-9]*)\\.?([0-9]*)(~?)")
+            continue()
+        endif()
+
+        set(range "${CMAKE_MATCH_1}")
+        set(type "${type_${CMAKE_MATCH_2}}")
+        set(number "${CMAKE_MATCH_3}")
+        set(bit "${CMAKE_MATCH_4}")
+        set(invert "${CMAKE_MATCH_5}")
+
+        if (number STREQUAL "")
+            set(number 0)
+        endif()
+        if (bit STREQUAL "")
+            set(bit 0)
+        endif()
+
+        if (type EQUAL type_h)
+            math(EXPR index "((${number} << 4) | ${bit}) & 255")
+        else()
+            math(EXPR index "${number} & 255")
+        endif()
+
+        set(scale 0)
+        set(offset 0)
+
+        if (type EQUAL type_a)
+            if (range STREQUAL "+")
+                set(scale 2)
+                set(offset -1)
+            elseif (range STREQUAL "-")
+                set(scale 2)
+                set(offset 1)
+            else()
+                set(scale 1)
+                set(offset 0)
+            endif()
+
+            if (invert STREQUAL "~")
+                math(EXPR scale "-(${scale})")
+                math(EXPR offset "-(${offset})")
+            endif()
+        endif()
+
+        set(${element} "${type},${index},${scale},${offset}")
+    endforeach()
+
+    string(TOLOWER "${guid}" guid)
+
+    # These must match the updateGamepadGUID functions of each platform
+    string(SUBSTRING "${guid}" 0 4 vendor)
+    string(SUBSTRING "${guid}" 4 4 win32_product)
+    string(SUBSTRING "${guid}" 16 4 cocoa_product)
+    string(SUBSTRING "${guid}" 4 12 cocoa_zeros1)
+    string(SUBSTRING "${guid}" 20 12 suffix)
+
+    if (platform STREQUAL "Windows" AND suffix STREQUAL "504944564944")
+        set(guid "03000000${vendor}0000${win32_product}000000000000")
+    elseif (platform STREQUAL "Mac OS X" AND
+            cocoa_zeros1 STREQUAL "000000000000" AND suffix STREQUAL "000000000000")
+        set(guid "03000000${vendor}0000${cocoa_product}000000000000")
+    endif()
+
+    set(buttons "{${button_0}}")
+    foreach(i RANGE 1 14)
+        string(APPEND buttons ",{${button_${i}}}")
+    endforeach()
+
+    set(axes "{${axis_0}}")
+    foreach(i RANGE 1 5)
+        string(APPEND axes ",{${axis_${i}}}")
+    endforeach()
+
+    set(${result} "${guid}{\"${name}\",\"${guid}\",{${buttons}},{${axes}}}," PARENT_SCOPE)
+endfunction()
+
+# Parses, de-duplicates and sorts the mappings of a single platform section
+# The first mapping for a given GUID takes precedence, as in the text database
+function(generate_table lines platform result)
+    set(entries "")
+
+    foreach(line ${lines})
+        parse_mapping("${line}" "${platform}" entry)
+        if (entry STREQUAL "")
+            continue()
+        endif()
+
+        string(SUBSTRING "${entry}" 0 32 guid)
+        if (DEFINED seen_${guid})
+            continue()
+        endif()
+
+        set(seen_${guid} TRUE)
+        list(APPEND entries "${entry}")
+    endforeach()
+
+    list(SORT entries)
+
+    set(table "")
+    foreach(entry ${entries})
+        string(SUBSTRING "${entry}" 32 -1 entry)
+        if (table)
+            string(APPEND table "\n")
+        endif()
+        string(APPEND table "${entry}")
+    endforeach()
+
+    set(${result} "${table}" PARENT_SCOPE)
+endfunction()
+
+set(section "")
+file(STRINGS "${source_path}" lines)
+foreach(line ${lines})
+    if (line MATCHES "^#if defined\\(_GLFW_WIN32\\)")
+        set(section WIN32)
+    elseif (line MATCHES "^#if defined\\(_GLFW_COCOA\\)")
+        set(section COCOA)
+    elseif (line MATCHES "^#if defined\\(GLFW_BUILD_LINUX_JOYSTICK\\)")
+        set(section LINUX)
+    elseif (line MATCHES "^#endif")
+        set(section "")
+    elseif (section AND line MATCHES "^\"(.*)\",$")
+        list(APPEND ${section}_lines "${CMAKE_MATCH_1}")
+    endif()
+endforeach()
+
+generate_table("${WIN32_lines}" "Windows" GLFW_WIN32_MAPPINGS)
+generate_table("${COCOA_lines}" "Mac OS X" GLFW_COCOA_MAPPINGS)
+generate_table("${LINUX_lines}" "Linux" GLFW_LINUX_MAPPINGS)
+
+configure_file("${template_path}" "${target_path}" @ONLY NEWLINE_STYLE UNIX)
@@ -608,6 +608,33 @@ extern "C" {
 #define GLFW_JOYSTICK_LAST          GLFW_JOYSTICK_16
 /*! @} */
 
+/*! @defgroup joystick_samples Joystick sample types
+ *  @brief Joystick sample types.
+ *
+ *  See [joystick sampling](@ref joystick_sampling) for how these are used.
+ *
+ *  @ingroup input
+ *  @{ */
+#define GLFW_JOYSTICK_SAMPLE_AXIS   1
+#define GLFW_JOYSTICK_SAMPLE_BUTTON 2
+#define GLFW_JOYSTICK_SAMPLE_HAT    3
+/*! @} */
+
+/*! @defgroup event_types Input event types
+ *  @brief Input event types.
+ *
+ *  See [event queue](@ref event_queue) for how these are used.
+ *
+ *  @ingroup input
+ *  @{ */
+#define GLFW_EVENT_KEY              1
+#define GLFW_EVENT_CHAR             2
+#define GLFW_EVENT_MOUSE_BUTTON     3
+#define GLFW_EVENT_CURSOR_POS       4
+#define GLFW_EVENT_CURSOR_ENTER     5
+#define GLFW_EVENT_SCROLL           6
+/*! @} */
+
 /*! @defgroup gamepad_buttons Gamepad buttons
  *  @brief Gamepad buttons.
  *
@@ -1142,6 +1169,7 @@ extern "C" {
 #define GLFW_STICKY_MOUSE_BUTTONS   0x00033003
 #define GLFW_LOCK_KEY_MODS          0x00033004
 #define GLFW_RAW_MOUSE_MOTION       0x00033005
+#define GLFW_CURSOR_COALESCING      0x00033006
 
 #define GLFW_CURSOR_NORMAL          0x00034001
 #define GLFW_CURSOR_HIDDEN          0x00034002
@@ -1292,6 +1320,21 @@ extern "C" {
  *  Platform selection [init hint](@ref GLFW_PLATFORM).
  */
 #define GLFW_PLATFORM               0x00050003
+/*! @brief Joystick sampling thread init hint.
+ *
+ *  Joystick sampling thread [init hint](@ref GLFW_JOYSTICK_SAMPLING_hint).
+ */
+#define GLFW_JOYSTICK_SAMPLING      0x00050004
+/*! @brief Input event queue init hint.
+ *
+ *  Input event queue [init hint](@ref GLFW_EVENT_QUEUE_hint).
+ */
+#define GLFW_EVENT_QUEUE            0x00050005
+/*! @brief Cursor and icon cache init hint.
+ *
+ *  Cursor and icon cache [init hint](@ref GLFW_IMAGE_CACHE_hint).
+ */
+#define GLFW_IMAGE_CACHE            0x00050006
 /*! @brief macOS specific init hint.
  *
  *  macOS specific [init hint](@ref GLFW_COCOA_CHDIR_RESOURCES_hint).
@@ -1922,6 +1965,25 @@ typedef void (* GLFWcharmodsfun)(GLFWwindow* window, unsigned int codepoint, int
  */
 typedef void (* GLFWdropfun)(GLFWwindow* window, int path_count, const char* paths[]);
 
+/*! @brief The function pointer type for user event callbacks.
+ *
+ *  This is the function pointer type for user event callbacks.  A user event
+ *  callback function has the following signature:
+ *  @code
+ *  void function_name(void* payload)
+ *  @endcode
+ *
+ *  @param[in] payload The payload passed to @ref glfwPostUserEvent.
+ *
+ *  @sa @ref user_events
+ *  @sa @ref glfwSetUserEventCallback
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup window
+ */
+typedef void (* GLFWusereventfun)(void* payload);
+
 /*! @brief The function pointer type for monitor configuration callbacks.
  *
  *  This is the function pointer type for monitor configuration callbacks.
@@ -1964,6 +2026,70 @@ typedef void (* GLFWmonitorfun)(GLFWmonitor* monitor, int event);
  */
 typedef void (* GLFWjoystickfun)(int jid, int event);
 
+/*! @brief The function pointer type for joystick axis callbacks.
+ *
+ *  This is the function pointer type for joystick axis callbacks.  A joystick
+ *  axis callback function has the following signature:
+ *  @code
+ *  void function_name(int jid, int axis, float position)
+ *  @endcode
+ *
+ *  @param[in] jid The joystick whose axis moved.
+ *  @param[in] axis The index of the axis that moved.
+ *  @param[in] position The new position of the axis, in the range -1.0 to 1.0
+ *  inclusive.
+ *
+ *  @sa @ref joystick_axis
+ *  @sa @ref glfwSetJoystickAxisCallback
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWjoystickaxisfun)(int jid, int axis, float position);
+
+/*! @brief The function pointer type for joystick button callbacks.
+ *
+ *  This is the function pointer type for joystick button callbacks.
+ *  A joystick button callback function has the following signature:
+ *  @code
+ *  void function_name(int jid, int button, int action)
+ *  @endcode
+ *
+ *  @param[in] jid The joystick whose button changed.
+ *  @param[in] button The index of the button that changed.
+ *  @param[in] action One of `GLFW_PRESS` or `GLFW_RELEASE`.
+ *
+ *  @sa @ref joystick_button
+ *  @sa @ref glfwSetJoystickButtonCallback
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWjoystickbuttonfun)(int jid, int button, int action);
+
+/*! @brief The function pointer type for joystick hat callbacks.
+ *
+ *  This is the function pointer type for joystick hat callbacks.  A joystick
+ *  hat callback function has the following signature:
+ *  @code
+ *  void function_name(int jid, int hat, int state)
+ *  @endcode
+ *
+ *  @param[in] jid The joystick whose hat changed.
+ *  @param[in] hat The index of the hat that changed.
+ *  @param[in] state The new [hat state](@ref hat_state).
+ *
+ *  @sa @ref joystick_hat
+ *  @sa @ref glfwSetJoystickHatCallback
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWjoystickhatfun)(int jid, int hat, int state);
+
 /*! @brief Video mode type.
  *
  *  This describes a single video mode.
@@ -2076,6 +2202,193 @@ typedef struct GLFWgamepadstate
     float axes[6];
 } GLFWgamepadstate;
 
+/*! @brief Joystick input sample.
+ *
+ *  This describes a single change to the state of a joystick axis, button or
+ *  hat, as recorded by the joystick sampling thread.
+ *
+ *  @sa @ref joystick_sampling
+ *  @sa @ref glfwGetJoystickSamples
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+typedef struct GLFWjoysticksample
+{
+    /*! The time of the change, in seconds, using the same time base as @ref
+     *  glfwGetTime.
+     */
+    double time;
+    /*! The [type](@ref joystick_samples) of the element that changed.
+     */
+    int type;
+    /*! The index of the axis, button or hat that changed.
+     */
+    int index;
+    /*! The new state of the element.  This is the axis position for axes,
+     *  `GLFW_PRESS` or `GLFW_RELEASE` for buttons and the
+     *  [hat state](@ref hat_state) for hats.
+     */
+    float value;
+} GLFWjoysticksample;
+
+/*! @brief Input event record.
+ *
+ *  This describes a single input event recorded in the event queue.  Only the
+ *  members used by the [type](@ref event_types) of the event are set and the
+ *  rest are zero.
+ *
+ *  Type                        | Members
+ *  --------------------------- | -------
+ *  `GLFW_EVENT_KEY`            | `key`, `scancode`, `action` and `mods`
+ *  `GLFW_EVENT_CHAR`           | `codepoint` and `mods`
+ *  `GLFW_EVENT_MOUSE_BUTTON`   | `button`, `action` and `mods`
+ *  `GLFW_EVENT_CURSOR_POS`     | `x` and `y`, the new cursor position
+ *  `GLFW_EVENT_CURSOR_ENTER`   | `action`, `GLFW_TRUE` if the cursor entered
+ *  `GLFW_EVENT_SCROLL`         | `x` and `y`, the scroll offset
+ *
+ *  The values have the same meaning as the parameters of the matching
+ *  callback.
+ *
+ *  @sa @ref event_queue
+ *  @sa @ref glfwGetEventQueue
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+typedef struct GLFWevent
+{
+    /*! The [type](@ref event_types) of the event.
+     */
+    int type;
+    /*! The time of the event, in seconds, using the same time base as @ref
+     *  glfwGetTime.  See @ref glfwGetEventTime for details.
+     */
+    double time;
+    /*! The window that received the event, or `NULL` if that window has
+     *  since been destroyed.
+     */
+    GLFWwindow* window;
+    /*! The [keyboard key](@ref keys).
+     */
+    int key;
+    /*! The platform-specific scancode of the key.
+     */
+    int scancode;
+    /*! The key or button action, or whether the cursor entered the window.
+     */
+    int action;
+    /*! The [modifier key flags](@ref mods).
+     */
+    int mods;
+    /*! The Unicode code point of the character.
+     */
+    unsigned int codepoint;
+    /*! The [mouse button](@ref buttons).
+     */
+    int button;
+    /*! The cursor x-coordinate or the scroll offset along the x-axis.
+     */
+    double x;
+    /*! The cursor y-coordinate or the scroll offset along the y-axis.
+     */
+    double y;
+} GLFWevent;
+
+/*! @brief Cursor history sample.
+ *
+ *  This describes a single cursor position or scroll offset received by
+ *  a window.
+ *
+ *  @sa @ref cursor_history
+ *  @sa @ref glfwSetCursorHistoryCallback
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+typedef struct GLFWcursorsample
+{
+    /*! Either @ref GLFW_EVENT_CURSOR_POS or @ref GLFW_EVENT_SCROLL.
+     */
+    int type;
+    /*! The time of the sample, in seconds, using the same time base as @ref
+     *  glfwGetTime.
+     */
+    double time;
+    /*! The cursor x-coordinate, relative to the left edge of the content area,
+     *  or the scroll offset along the x-axis.
+     */
+    double x;
+    /*! The cursor y-coordinate, relative to the top edge of the content area,
+     *  or the scroll offset along the y-axis.
+     */
+    double y;
+} GLFWcursorsample;
+
+/*! @brief The function pointer type for cursor history callbacks.
+ *
+ *  This is the function pointer type for cursor history callbacks.  A cursor
+ *  history callback function has the following signature:
+ *  @code
+ *  void function_name(GLFWwindow* window, const GLFWcursorsample* samples, int count)
+ *  @endcode
+ *
+ *  @param[in] window The window that received the events.
+ *  @param[in] samples The cursor positions and scroll offsets received by the
+ *  window during the last event processing call, in the order they were
+ *  received.
+ *  @param[in] count The number of elements in the `samples` array.
+ *
+ *  @pointer_lifetime The samples array is valid until the callback function
+ *  returns.
+ *
+ *  @sa @ref cursor_history
+ *  @sa @ref glfwSetCursorHistoryCallback
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWcursorhistoryfun)(GLFWwindow* window, const GLFWcursorsample* samples, int count);
+
+/*! @brief Frame pacing statistics.
+ *
+ *  This describes the frames paced by @ref glfwWaitFrame since the previous
+ *  call to @ref glfwGetFrameStats.  All times are in seconds.
+ *
+ *  @sa @ref frame_pacing
+ *  @sa @ref glfwGetFrameStats
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup window
+ */
+typedef struct GLFWframestats
+{
+    /*! The number of frames measured.
+     */
+    int frameCount;
+    /*! The number of frame deadlines that were skipped because a frame took
+     *  too long.
+     */
+    int missedCount;
+    /*! The average time between the start of consecutive frames.
+     */
+    double averageTime;
+    /*! The shortest time between the start of consecutive frames.
+     */
+    double minimumTime;
+    /*! The longest time between the start of consecutive frames.
+     */
+    double maximumTime;
+    /*! The longest time a frame started after its deadline.
+     */
+    double maximumLateness;
+} GLFWframestats;
+
 /*! @brief
  *
  *  @sa @ref init_allocator
@@ -4522,6 +4835,146 @@ GLFWAPI void glfwWaitEvents(void);
  */
 GLFWAPI void glfwWaitEventsTimeout(double timeout);
 
+/*! @brief Waits until events are queued or a deadline passes and processes
+ *  them.
+ *
+ *  This function puts the calling thread to sleep until at least one event is
+ *  available in the event queue, or until the raw timer reaches the specified
+ *  value.  If one or more events are available, it behaves exactly like @ref
+ *  glfwPollEvents, i.e. the events in the queue are processed and the function
+ *  then returns immediately.  Processing events will cause the window and input
+ *  callbacks associated with those events to be called.
+ *
+ *  Unlike the relative timeout of @ref glfwWaitEventsTimeout, the deadline is
+ *  absolute and in the same units as @ref glfwGetTimerValue, so a loop that
+ *  repeatedly waits until a computed point in time does not accumulate the
+ *  time spent between computing the timeout and starting to wait.  If the
+ *  deadline has already passed, this function behaves like @ref
+ *  glfwPollEvents.
+ *
+ *  Since not all events are associated with callbacks, this function may return
+ *  without a callback having been called even if you are monitoring all
+ *  callbacks.
+ *
+ *  On some platforms, a window move, resize or menu operation will cause event
+ *  processing to block.  This is due to how event processing is designed on
+ *  those platforms.  You can use the
+ *  [window refresh callback](@ref window_refresh) to redraw the contents of
+ *  your window when necessary during such operations.
+ *
+ *  Event processing is not required for joystick input to work.
+ *
+ *  @param[in] timerValue The value of the raw timer at which to stop waiting.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @linux On X11 and Wayland the deadline is waited for with an
+ *  absolute timer.  On other platforms it is converted to a timeout just before
+ *  waiting.
+ *
+ *  @reentrancy This function must not be called from a callback.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref events
+ *  @sa @ref glfwWaitEventsTimeout
+ *  @sa @ref glfwGetTimerValue
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwWaitEventsUntil(uint64_t timerValue);
+
+/*! @brief Sets the target frame period used by @ref glfwWaitFrame.
+ *
+ *  This function sets the target frame period used by @ref glfwWaitFrame and
+ *  how much of the end of each period is busy-waited instead of slept.  It
+ *  also restarts the frame pacing and discards any collected statistics.
+ *
+ *  Sleeping is subject to the wakeup latency of the scheduler, which is often
+ *  around a millisecond.  Busy-waiting the last part of each period avoids this
+ *  at the cost of keeping the CPU busy for that time.
+ *
+ *  @param[in] period The target time, in seconds, between the start of
+ *  consecutive frames, or zero to disable frame pacing.
+ *  @param[in] spin The time, in seconds, at the end of each period to
+ *  busy-wait.  This must not be greater than the period.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_INVALID_VALUE.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref frame_pacing
+ *  @sa @ref glfwWaitFrame
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwSetFramePacing(double period, double spin);
+
+/*! @brief Processes events until the next frame should start.
+ *
+ *  This function processes events until the next frame should start according
+ *  to the period set with @ref glfwSetFramePacing and then returns.  Events are
+ *  processed as they arrive while waiting, as with @ref glfwWaitEventsUntil,
+ *  except during the busy-waited end of the period.  Those are processed when
+ *  this function is next called.
+ *
+ *  The first call after frame pacing is set starts the first frame without
+ *  waiting.  If a frame takes longer than the period, the next frame starts
+ *  immediately and pacing continues from there, rather than trying to catch up
+ *  on the deadlines that were missed.
+ *
+ *  If frame pacing is disabled, this function behaves like @ref
+ *  glfwPollEvents.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark The null platform has no events to wait for, so on that platform
+ *  this function busy-waits for the whole period.
+ *
+ *  @reentrancy This function must not be called from a callback.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref frame_pacing
+ *  @sa @ref glfwSetFramePacing
+ *  @sa @ref glfwGetFrameStats
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwWaitFrame(void);
+
+/*! @brief Retrieves frame pacing statistics.
+ *
+ *  This function retrieves statistics about the frames started by @ref
+ *  glfwWaitFrame since the previous call to this function or to @ref
+ *  glfwSetFramePacing, and then resets them.
+ *
+ *  If an error occurs, all members of the statistics are set to zero.
+ *
+ *  @param[out] stats Where to store the statistics.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref frame_pacing
+ *  @sa @ref glfwWaitFrame
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwGetFrameStats(GLFWframestats* stats);
+
 /*! @brief Posts an empty event to the event queue.
  *
  *  This function posts an empty event from the current thread to the event
@@ -4542,17 +4995,117 @@ GLFWAPI void glfwWaitEventsTimeout(double timeout);
  */
 GLFWAPI void glfwPostEmptyEvent(void);
 
+/*! @brief Posts a user event to the event queue.
+ *
+ *  This function posts a user event with the specified payload from the
+ *  current thread.  The payload is passed to the
+ *  [user event callback](@ref glfwSetUserEventCallback) on the main thread at
+ *  the end of the next call to @ref glfwPollEvents, @ref glfwWaitEvents or
+ *  another event processing function.  User events are delivered in the order
+ *  they were posted.
+ *
+ *  Posting a user event does not block and does not take any locks.  Only the
+ *  first event posted since the main thread last delivered them wakes it, like
+ *  @ref glfwPostEmptyEvent, so posting many events in quick succession is
+ *  cheap.
+ *
+ *  If no user event callback is set when the event is delivered, the event is
+ *  discarded.  Events not yet delivered when the library is terminated are
+ *  discarded.
+ *
+ *  @param[in] payload The payload to pass to the user event callback.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_OUT_OF_MEMORY and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref user_events
+ *  @sa @ref glfwSetUserEventCallback
+ *  @sa @ref glfwPostEmptyEvent
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup window
+ */
+GLFWAPI void glfwPostUserEvent(void* payload);
+
+/*! @brief Sets the user event callback.
+ *
+ *  This function sets the user event callback, which is called on the main
+ *  thread with the payload of each event posted with @ref glfwPostUserEvent.
+ *
+ *  @param[in] callback The new callback, or `NULL` to remove the currently set
+ *  callback.
+ *  @return The previously set callback, or `NULL` if no callback was set or the
+ *  library had not been [initialized](@ref intro_init).
+ *
+ *  @callback_signature
+ *  @code
+ *  void function_name(void* payload)
+ *  @endcode
+ *  For more information about the callback parameters, see the
+ *  [function pointer type](@ref GLFWusereventfun).
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref user_events
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup window
+ */
+GLFWAPI GLFWusereventfun glfwSetUserEventCallback(GLFWusereventfun callback);
+
+/*! @brief Returns the input events recorded since the last call.
+ *
+ *  This function returns the input events recorded since the last call to this
+ *  function, in the order they were received, and starts a new recording.
+ *
+ *  Input events are only recorded if the @ref GLFW_EVENT_QUEUE_hint init hint
+ *  was set when the library was initialized.  Recording happens in addition
+ *  to any callbacks that are set, just before they are called, and includes
+ *  input events received outside of event processing.
+ *
+ *  @param[out] count Where to store the number of events in the returned
+ *  array.  This is set to zero if there are no events or an
+ *  [error](@ref error_handling) occurred.
+ *  @return An array of input events, or `NULL` if there are no events or an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @pointer_lifetime The returned array is allocated and freed by GLFW.  You
+ *  should not free it yourself.  It is valid until the next call to this
+ *  function or until the library is terminated.  When a window is destroyed,
+ *  the `window` member of its events in the array is set to `NULL`.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *  The returned array is only modified by GLFW while it is valid when
+ *  a window is destroyed, and may be read from any thread as long as that is
+ *  not done during @ref glfwDestroyWindow.
+ *
+ *  @sa @ref event_queue
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup window
+ */
+GLFWAPI const GLFWevent* glfwGetEventQueue(int* count);
+
 /*! @brief Returns the value of an input option for the specified window.
  *
  *  This function returns the value of an input option for the specified window.
  *  The mode must be one of @ref GLFW_CURSOR, @ref GLFW_STICKY_KEYS,
- *  @ref GLFW_STICKY_MOUSE_BUTTONS, @ref GLFW_LOCK_KEY_MODS or
- *  @ref GLFW_RAW_MOUSE_MOTION.
+ *  @ref GLFW_STICKY_MOUSE_BUTTONS, @ref GLFW_LOCK_KEY_MODS,
+ *  @ref GLFW_RAW_MOUSE_MOTION or @ref GLFW_CURSOR_COALESCING.
  *
  *  @param[in] window The window to query.
  *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS`,
- *  `GLFW_STICKY_MOUSE_BUTTONS`, `GLFW_LOCK_KEY_MODS` or
- *  `GLFW_RAW_MOUSE_MOTION`.
+ *  `GLFW_STICKY_MOUSE_BUTTONS`, `GLFW_LOCK_KEY_MODS`,
+ *  `GLFW_RAW_MOUSE_MOTION` or `GLFW_CURSOR_COALESCING`.
  *
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
  *  GLFW_INVALID_ENUM.
@@ -4571,8 +5124,8 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* window, int mode);
  *
  *  This function sets an input mode option for the specified window.  The mode
  *  must be one of @ref GLFW_CURSOR, @ref GLFW_STICKY_KEYS,
- *  @ref GLFW_STICKY_MOUSE_BUTTONS, @ref GLFW_LOCK_KEY_MODS or
- *  @ref GLFW_RAW_MOUSE_MOTION.
+ *  @ref GLFW_STICKY_MOUSE_BUTTONS, @ref GLFW_LOCK_KEY_MODS,
+ *  @ref GLFW_RAW_MOUSE_MOTION or @ref GLFW_CURSOR_COALESCING.
  *
  *  If the mode is `GLFW_CURSOR`, the value must be one of the following cursor
  *  modes:
@@ -4612,10 +5165,20 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* window, int mode);
  *  attempting to set this will emit @ref GLFW_FEATURE_UNAVAILABLE.  Call @ref
  *  glfwRawMouseMotionSupported to check for support.
  *
+ *  If the mode is `GLFW_CURSOR_COALESCING`, the value must be either
+ *  `GLFW_TRUE` to enable cursor motion coalescing, or `GLFW_FALSE` to disable
+ *  it.  If enabled, all cursor motion received during a single call to @ref
+ *  glfwPollEvents, @ref glfwWaitEvents or @ref glfwWaitEventsTimeout is
+ *  reported as a single cursor position event with the most recent position.
+ *  When the cursor is disabled, this is the sum of all the motion received.
+ *  Any pending motion is reported before mouse button, scroll and cursor
+ *  enter/leave events to preserve their order.  The individual positions are
+ *  still available via the [cursor history callback](@ref cursor_history).
+ *
  *  @param[in] window The window whose input mode to set.
  *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS`,
- *  `GLFW_STICKY_MOUSE_BUTTONS`, `GLFW_LOCK_KEY_MODS` or
- *  `GLFW_RAW_MOUSE_MOTION`.
+ *  `GLFW_STICKY_MOUSE_BUTTONS`, `GLFW_LOCK_KEY_MODS`,
+ *  `GLFW_RAW_MOUSE_MOTION` or `GLFW_CURSOR_COALESCING`.
  *  @param[in] value The new value of the specified input mode.
  *
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
@@ -4922,12 +5485,18 @@ GLFWAPI void glfwSetCursorPos(GLFWwindow* window, double xpos, double ypos);
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
  *  GLFW_INVALID_VALUE and @ref GLFW_PLATFORM_ERROR.
  *
+ *  If the @ref GLFW_IMAGE_CACHE_hint init hint is enabled, creating a cursor
+ *  with the same image and hotspot as an existing custom cursor returns the
+ *  existing cursor.  Each returned handle must still be destroyed with @ref
+ *  glfwDestroyCursor.
+ *
  *  @pointer_lifetime The specified image data is copied before this function
  *  returns.
  *
  *  @thread_safety This function must only be called from the main thread.
  *
  *  @sa @ref cursor_object
+ *  @sa @ref cursor_cache
  *  @sa @ref glfwDestroyCursor
  *  @sa @ref glfwCreateStandardCursor
  *
@@ -4937,6 +5506,53 @@ GLFWAPI void glfwSetCursorPos(GLFWwindow* window, double xpos, double ypos);
  */
 GLFWAPI GLFWcursor* glfwCreateCursor(const GLFWimage* image, int xhot, int yhot);
 
+/*! @brief Creates an animated custom cursor.
+ *
+ *  Creates a new custom cursor that cycles through the specified images, each
+ *  shown for its corresponding delay.  All frames are uploaded when the cursor
+ *  is created and the animation then runs without further calls, either by the
+ *  window system or by the event processing functions.  The cursor is set and
+ *  destroyed like any other cursor object.
+ *
+ *  The pixel format and hotspot are the same as for @ref glfwCreateCursor.  The
+ *  hotspot is shared by all frames.
+ *
+ *  @param[in] images The frames of the cursor, in order.
+ *  @param[in] count The number of frames in the `images` array.
+ *  @param[in] delays The time, in seconds, that each frame is shown.  This
+ *  array must have `count` elements and every delay must be positive.
+ *  @param[in] xhot The desired x-coordinate, in pixels, of the cursor hotspot.
+ *  @param[in] yhot The desired y-coordinate, in pixels, of the cursor hotspot.
+ *  @return The handle of the created cursor, or `NULL` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @pointer_lifetime The specified image data and delays are copied before
+ *  this function returns.
+ *
+ *  @remark @x11 The animation is performed by the X server.  Servers without
+ *  support for animated cursors will show only the first frame.
+ *
+ *  @remark @wayland The animation is driven by event processing, like the
+ *  animated standard cursors of the cursor theme.
+ *
+ *  @remark @win32 @macos Animated cursors are not supported and only the first
+ *  frame is shown.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref cursor_animated
+ *  @sa @ref glfwCreateCursor
+ *  @sa @ref glfwDestroyCursor
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI GLFWcursor* glfwCreateAnimatedCursor(const GLFWimage* images, int count, const double* delays, int xhot, int yhot);
+
 /*! @brief Creates a cursor with a standard shape.
  *
  *  Returns a cursor with a standard shape, that can be set for a window with
@@ -4994,6 +5610,10 @@ GLFWAPI GLFWcursor* glfwCreateStandardCursor(int shape);
  *  If the specified cursor is current for any window, that window will be
  *  reverted to the default cursor.  This does not affect the cursor mode.
  *
+ *  If the cursor was returned more than once by the [cursor
+ *  cache](@ref cursor_cache), this only releases one of its handles and the
+ *  cursor remains valid and current until the last handle is destroyed.
+ *
  *  @param[in] cursor The cursor object to destroy.
  *
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
@@ -5243,6 +5863,41 @@ GLFWAPI GLFWmousebuttonfun glfwSetMouseButtonCallback(GLFWwindow* window, GLFWmo
  */
 GLFWAPI GLFWcursorposfun glfwSetCursorPosCallback(GLFWwindow* window, GLFWcursorposfun callback);
 
+/*! @brief Sets the cursor history callback.
+ *
+ *  This function sets the cursor history callback of the specified window,
+ *  which is called once at the end of each call to @ref glfwPollEvents, @ref
+ *  glfwWaitEvents or @ref glfwWaitEventsTimeout during which the cursor was
+ *  moved or a scrolling device was used.  The callback is provided with every
+ *  cursor position and scroll offset received by the window during that call,
+ *  in order, including the positions merged by the @ref GLFW_CURSOR_COALESCING
+ *  input mode.
+ *
+ *  @param[in] window The window whose callback to set.
+ *  @param[in] callback The new callback, or `NULL` to remove the currently set
+ *  callback.
+ *  @return The previously set callback, or `NULL` if no callback was set or the
+ *  library had not been [initialized](@ref intro_init).
+ *
+ *  @callback_signature
+ *  @code
+ *  void function_name(GLFWwindow* window, const GLFWcursorsample* samples, int count)
+ *  @endcode
+ *  For more information about the callback parameters, see the
+ *  [function pointer type](@ref GLFWcursorhistoryfun).
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref cursor_history
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI GLFWcursorhistoryfun glfwSetCursorHistoryCallback(GLFWwindow* window, GLFWcursorhistoryfun callback);
+
 /*! @brief Sets the cursor enter/leave callback.
  *
  *  This function sets the cursor boundary crossing callback of the specified
@@ -5402,6 +6057,48 @@ GLFWAPI int glfwJoystickPresent(int jid);
  */
 GLFWAPI const float* glfwGetJoystickAxes(int jid, int* count);
 
+/*! @brief Sets the axis deadzone and fuzz filter of the specified joystick.
+ *
+ *  This function sets the deadzone and fuzz of the axes of the specified
+ *  joystick.  Axis positions within the deadzone around the center are
+ *  reported as zero, and axis changes smaller than the fuzz are ignored unless
+ *  the axis reaches its center or either end.  Together these keep noisy sticks
+ *  from reporting a constant stream of tiny changes.  Both are zero by default,
+ *  which disables filtering.
+ *
+ *  The filter is applied to the axes returned by @ref glfwGetJoystickAxes and
+ *  to the axis state of any [gamepad mapping](@ref gamepad).  The deadzone is
+ *  applied around the center of every axis, including triggers.
+ *
+ *  The new deadzone is also applied to the current axis positions.  Positions
+ *  that were already filtered out by a previous deadzone are not restored.
+ *
+ *  The filter applies to the current connection of the joystick and is reset
+ *  when it is disconnected.  If the specified joystick is not present this
+ *  function does nothing and does not generate an error.
+ *
+ *  @param[in] jid The [joystick](@ref joysticks) whose filter to set.
+ *  @param[in] deadzone The deadzone, in the range 0.0 to 1.0 exclusive, or
+ *  `GLFW_DONT_CARE` to use the deadzone reported by the device, if any.
+ *  @param[in] fuzz The smallest axis change to report, in the range 0.0 to 2.0
+ *  inclusive.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_ENUM, @ref GLFW_INVALID_VALUE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @linux The device deadzone is the flat range of each axis.  Other
+ *  platforms currently do not report a device deadzone.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref joystick_axis
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwSetJoystickAxisFilter(int jid, float deadzone, float fuzz);
+
 /*! @brief Returns the state of all buttons of the specified joystick.
  *
  *  This function returns the state of all buttons of the specified joystick.
@@ -5686,6 +6383,145 @@ GLFWAPI int glfwJoystickIsGamepad(int jid);
  */
 GLFWAPI GLFWjoystickfun glfwSetJoystickCallback(GLFWjoystickfun callback);
 
+/*! @brief Sets the joystick axis callback.
+ *
+ *  This function sets the joystick axis callback, or removes the currently
+ *  set callback.  This is called when the position of a joystick axis changes.
+ *
+ *  Joystick state is updated when joysticks are polled or when events are
+ *  [processed](@ref events), depending on the platform, and this callback is
+ *  called from there.  Each change is only reported once.
+ *
+ *  @param[in] callback The new callback, or `NULL` to remove the currently set
+ *  callback.
+ *  @return The previously set callback, or `NULL` if no callback was set or the
+ *  library had not been [initialized](@ref intro_init).
+ *
+ *  @callback_signature
+ *  @code
+ *  void function_name(int jid, int axis, float position)
+ *  @endcode
+ *  For more information about the callback parameters, see the
+ *  [function pointer type](@ref GLFWjoystickaxisfun).
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref joystick_axis
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI GLFWjoystickaxisfun glfwSetJoystickAxisCallback(GLFWjoystickaxisfun callback);
+
+/*! @brief Sets the joystick button callback.
+ *
+ *  This function sets the joystick button callback, or removes the currently
+ *  set callback.  This is called when a joystick button is pressed or
+ *  released.  If the @ref GLFW_JOYSTICK_HAT_BUTTONS init hint is set, this is
+ *  also called for the buttons that hats are exposed as.
+ *
+ *  Joystick state is updated when joysticks are polled or when events are
+ *  [processed](@ref events), depending on the platform, and this callback is
+ *  called from there.  Each change is only reported once.
+ *
+ *  @param[in] callback The new callback, or `NULL` to remove the currently set
+ *  callback.
+ *  @return The previously set callback, or `NULL` if no callback was set or the
+ *  library had not been [initialized](@ref intro_init).
+ *
+ *  @callback_signature
+ *  @code
+ *  void function_name(int jid, int button, int action)
+ *  @endcode
+ *  For more information about the callback parameters, see the
+ *  [function pointer type](@ref GLFWjoystickbuttonfun).
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref joystick_button
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI GLFWjoystickbuttonfun glfwSetJoystickButtonCallback(GLFWjoystickbuttonfun callback);
+
+/*! @brief Sets the joystick hat callback.
+ *
+ *  This function sets the joystick hat callback, or removes the currently set
+ *  callback.  This is called when the state of a joystick hat changes.
+ *
+ *  Joystick state is updated when joysticks are polled or when events are
+ *  [processed](@ref events), depending on the platform, and this callback is
+ *  called from there.  Each change is only reported once.
+ *
+ *  @param[in] callback The new callback, or `NULL` to remove the currently set
+ *  callback.
+ *  @return The previously set callback, or `NULL` if no callback was set or the
+ *  library had not been [initialized](@ref intro_init).
+ *
+ *  @callback_signature
+ *  @code
+ *  void function_name(int jid, int hat, int state)
+ *  @endcode
+ *  For more information about the callback parameters, see the
+ *  [function pointer type](@ref GLFWjoystickhatfun).
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref joystick_hat
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI GLFWjoystickhatfun glfwSetJoystickHatCallback(GLFWjoystickhatfun callback);
+
+/*! @brief Retrieves the joystick input samples recorded since the last call.
+ *
+ *  This function moves the oldest recorded input samples of the specified
+ *  joystick into the specified array, in the order they were recorded, and
+ *  returns the number of samples moved.  Call it until it returns less than
+ *  the size of the array to retrieve every sample recorded so far.
+ *
+ *  Samples are only recorded if the @ref GLFW_JOYSTICK_SAMPLING_hint init hint
+ *  was set when the library was initialized.  A background thread then reads
+ *  the joystick devices as soon as their input arrives and timestamps each
+ *  change, so that no intermediate states are lost between frames.  Samples
+ *  become available to this function when events are processed.  If the
+ *  history is not retrieved often enough, the oldest samples are discarded.
+ *
+ *  If the specified joystick is not present or no samples are recorded, this
+ *  function will return zero but will not generate an error.
+ *
+ *  @param[in] jid The [joystick](@ref joysticks) to query.
+ *  @param[out] samples The array to move the samples into.
+ *  @param[in] count The size of the array.
+ *  @return The number of samples moved into the array.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_ENUM, @ref GLFW_INVALID_VALUE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @linux This is currently the only platform that records samples.
+ *  On other platforms this function always returns zero.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref joystick_sampling
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwGetJoystickSamples(int jid, GLFWjoysticksample* samples, int count);
+
 /*! @brief Adds the specified SDL_GameControllerDB gamepad mappings.
  *
  *  This function parses the specified ASCII encoded string and updates the
@@ -5720,6 +6556,40 @@ GLFWAPI GLFWjoystickfun glfwSetJoystickCallback(GLFWjoystickfun callback);
  */
 GLFWAPI int glfwUpdateGamepadMappings(const char* string);
 
+/*! @brief Adds the SDL_GameControllerDB gamepad mappings in the specified file.
+ *
+ *  This function reads the specified ASCII encoded file and updates the
+ *  internal list with any gamepad mappings it finds, in the same way as @ref
+ *  glfwUpdateGamepadMappings.  The file is mapped into memory and parsed in
+ *  place, and mappings for other platforms are skipped without being fully
+ *  parsed, making this the preferred way to load a large mapping database such
+ *  as `gamecontrollerdb.txt`.
+ *
+ *  See @ref gamepad_mapping for a description of the format.
+ *
+ *  If there is already a gamepad mapping for a given GUID in the internal list,
+ *  it will be replaced by the one in the file.  If the library is terminated
+ *  and re-initialized the internal list will revert to the built-in default.
+ *
+ *  @param[in] path The UTF-8 encoded path of the file containing the gamepad
+ *  mappings.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref gamepad
+ *  @sa @ref glfwUpdateGamepadMappings
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwLoadGamepadMappingsFile(const char* path);
+
 /*! @brief Returns the human-readable gamepad name for the specified joystick.
  *
  *  This function returns the human-readable name of the gamepad from the
@@ -5790,6 +6660,46 @@ GLFWAPI const char* glfwGetGamepadName(int jid);
  */
 GLFWAPI int glfwGetGamepadState(int jid, GLFWgamepadstate* state);
 
+/*! @brief Retrieves the state of all joysticks remapped as gamepads.
+ *
+ *  This function retrieves the state of every connected joystick that has
+ *  a gamepad mapping, remapped to an Xbox-like gamepad, in a single call.  The
+ *  state of each joystick is written to the element of the array with the
+ *  same index as its joystick ID.
+ *
+ *  Each bit of the connected mask corresponds to the joystick ID with the same
+ *  index and is set if that joystick is present and has a gamepad mapping.  The
+ *  elements for joysticks without a set bit are cleared.  Joysticks that are
+ *  not present or have no mapping do not generate an error.
+ *
+ *  This is equivalent to calling @ref glfwGetGamepadState for every joystick
+ *  ID, but checks the library state only once and skips joysticks that are not
+ *  gamepads.
+ *
+ *  @param[out] states An array of `GLFW_JOYSTICK_LAST + 1` elements where the
+ *  gamepad input states are stored.
+ *  @param[out] connectedMask Where to store the bit mask of joysticks whose
+ *  gamepad state was retrieved.
+ *  @return `GLFW_TRUE` if the state of any gamepad was retrieved, or
+ *  `GLFW_FALSE` if no gamepad is connected or an [error](@ref error_handling)
+ *  occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @remark @linux The pending input of every joystick is read at once, when
+ *  the first gamepad is polled, unless events were processed shortly before.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref gamepad
+ *  @sa @ref glfwGetGamepadState
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwGetAllGamepadStates(GLFWgamepadstate* states, unsigned int* connectedMask);
+
 /*! @brief Sets the clipboard to the specified string.
  *
  *  This function sets the system clipboard to the specified, UTF-8 encoded
@@ -5947,6 +6857,39 @@ GLFWAPI uint64_t glfwGetTimerValue(void);
  */
 GLFWAPI uint64_t glfwGetTimerFrequency(void);
 
+/*! @brief Returns the time of the input event being reported.
+ *
+ *  This function returns the time when the input event currently being
+ *  reported to a callback happened, in seconds, using the same time base as
+ *  @ref glfwGetTime.  When called outside of an input callback, it returns the
+ *  time of the most recently reported input event.
+ *
+ *  Where the platform provides timestamps for input events, they are converted
+ *  to the [raw timer](@ref glfwGetTimerValue) and used.  Otherwise the time is
+ *  when GLFW received the event.  The difference between @ref glfwGetTime and
+ *  this time is the latency of the event as seen by the application.
+ *
+ *  This applies to the keyboard, text, mouse button, cursor, scroll, path drop
+ *  and joystick input callbacks.
+ *
+ *  @return The time of the input event, in seconds, or zero if no input event
+ *  has been reported or an [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @remark @wayland The time of key repeat events is when GLFW generated them.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref time
+ *  @sa @ref glfwGetTime
+ *
+ *  @since Added in version 3.4.
+ *
+ *  @ingroup input
+ */
+GLFWAPI double glfwGetEventTime(void);
+
 /*! @brief Makes the context of the specified window current for the calling
  *  thread.
  *
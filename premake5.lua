@@ -13,6 +13,7 @@ project "GLFW"
 		"src/internal.h",
 		"src/platform.h",
 		"src/mappings.h",
+		"src/mapping_table.h",
 		"src/context.c",
 		"src/init.c",
 		"src/glfw_config.h",
@@ -37,6 +38,7 @@ project "GLFW"
 		{
 			"src/win32_init.c",
 			"src/win32_module.c",
+			"src/win32_file.c",
 			"src/win32_joystick.c",
 			"src/win32_monitor.c",
 			"src/win32_time.h",
@@ -504,6 +504,7 @@ GLFWbool _glfwConnectCocoa(int platformID, _GLFWplatform* platform)
         _glfwSetRawMouseMotionCocoa,
         _glfwRawMouseMotionSupportedCocoa,
         _glfwCreateCursorCocoa,
+        _glfwCreateAnimatedCursorCocoa,
         _glfwCreateStandardCursorCocoa,
         _glfwDestroyCursorCocoa,
         _glfwSetCursorCocoa,
@@ -560,6 +561,7 @@ GLFWbool _glfwConnectCocoa(int platformID, _GLFWplatform* platform)
         _glfwPollEventsCocoa,
         _glfwWaitEventsCocoa,
         _glfwWaitEventsTimeoutCocoa,
+        _glfwWaitEventsUntilCocoa,
         _glfwPostEmptyEventCocoa,
         _glfwGetEGLPlatformCocoa,
         _glfwGetEGLNativeDisplayCocoa,
@@ -254,6 +254,7 @@ GLFWbool _glfwRawMouseMotionSupportedCocoa(void);
 void _glfwPollEventsCocoa(void);
 void _glfwWaitEventsCocoa(void);
 void _glfwWaitEventsTimeoutCocoa(double timeout);
+void _glfwWaitEventsUntilCocoa(uint64_t timerValue);
 void _glfwPostEmptyEventCocoa(void);
 
 void _glfwGetCursorPosCocoa(_GLFWwindow* window, double* xpos, double* ypos);
@@ -262,6 +263,7 @@ void _glfwSetCursorModeCocoa(_GLFWwindow* window, int mode);
 const char* _glfwGetScancodeNameCocoa(int scancode);
 int _glfwGetKeyScancodeCocoa(int key);
 GLFWbool _glfwCreateCursorCocoa(_GLFWcursor* cursor, const GLFWimage* image, int xhot, int yhot);
+GLFWbool _glfwCreateAnimatedCursorCocoa(_GLFWcursor* cursor, const GLFWimage* images, int count, const double* delays, int xhot, int yhot);
 GLFWbool _glfwCreateStandardCursorCocoa(_GLFWcursor* cursor, int shape);
 void _glfwDestroyCursorCocoa(_GLFWcursor* cursor);
 void _glfwSetCursorCocoa(_GLFWwindow* window, _GLFWcursor* cursor);
@@ -193,6 +193,17 @@ static NSUInteger translateKeyToModifierFlag(int key)
     return 0;
 }
 
+// Dispatches the specified event with its time as the time of any input it
+// generates
+// Event timestamps are in seconds of the same clock as mach_absolute_time
+//
+static void sendEvent(NSEvent* event)
+{
+    _glfwInputEventTime((uint64_t) ([event timestamp] * _glfw.timer.ns.frequency));
+    [NSApp sendEvent:event];
+    _glfwInputEventTime(0);
+}
+
 // Defines a constant for empty ranges in NSTextInputClient
 //
 static const NSRange kEmptyRange = { NSNotFound, 0 };
@@ -1523,7 +1534,7 @@ void _glfwPollEventsCocoa(void)
         if (event == nil)
             break;
 
-        [NSApp sendEvent:event];
+        sendEvent(event);
     }
 
     } // autoreleasepool
@@ -1540,7 +1551,7 @@ void _glfwWaitEventsCocoa(void)
                                         untilDate:[NSDate distantFuture]
                                            inMode:NSDefaultRunLoopMode
                                           dequeue:YES];
-    [NSApp sendEvent:event];
+    sendEvent(event);
 
     _glfwPollEventsCocoa();
 
@@ -1557,13 +1568,22 @@ void _glfwWaitEventsTimeoutCocoa(double timeout)
                                            inMode:NSDefaultRunLoopMode
                                           dequeue:YES];
     if (event)
-        [NSApp sendEvent:event];
+        sendEvent(event);
 
     _glfwPollEventsCocoa();
 
     } // autoreleasepool
 }
 
+void _glfwWaitEventsUntilCocoa(uint64_t timerValue)
+{
+    const double timeout =
+        ((double) timerValue - (double) _glfwPlatformGetTimerValue()) /
+        _glfwPlatformGetTimerFrequency();
+
+    _glfwWaitEventsTimeoutCocoa(timeout > 0.0 ? timeout : 0.0);
+}
+
 void _glfwPostEmptyEventCocoa(void)
 {
     @autoreleasepool {
@@ -1748,6 +1768,17 @@ GLFWbool _glfwCreateCursorCocoa(_GLFWcursor* cursor,
     } // autoreleasepool
 }
 
+GLFWbool _glfwCreateAnimatedCursorCocoa(_GLFWcursor* cursor,
+                                        const GLFWimage* images,
+                                        int count,
+                                        const double* delays,
+                                        int xhot, int yhot)
+{
+    // NOTE: NSCursor has no support for animation, so only the first frame is
+    //       used
+    return _glfwCreateCursorCocoa(cursor, images, xhot, yhot);
+}
+
 GLFWbool _glfwCreateStandardCursorCocoa(_GLFWcursor* cursor, int shape)
 {
     @autoreleasepool {
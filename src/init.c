@@ -52,6 +52,9 @@ static GLFWallocator _glfwInitAllocator;
 static _GLFWinitconfig _glfwInitHints =
 {
     GLFW_TRUE,      // hat buttons
+    GLFW_FALSE,     // joystick sampling thread
+    GLFW_FALSE,     // input event queue
+    GLFW_TRUE,      // cursor and icon cache
     GLFW_ANGLE_PLATFORM_TYPE_NONE, // ANGLE backend
     GLFW_ANY_PLATFORM, // preferred platform
     NULL,           // vkGetInstanceProcAddr function
@@ -114,6 +117,21 @@ static void terminate(void)
     _glfw_free(_glfw.mappings);
     _glfw.mappings = NULL;
     _glfw.mappingCount = 0;
+    _glfw.mappingCapacity = 0;
+
+    _glfw_free(_glfw.mappingIndex);
+    _glfw.mappingIndex = NULL;
+    _glfw.mappingIndexSize = 0;
+
+    _glfw_free(_glfw.eventQueue.events[0]);
+    _glfw_free(_glfw.eventQueue.events[1]);
+
+    while (_glfw.userEvents.head)
+    {
+        _GLFWuserevent* event = _glfw.userEvents.head;
+        _glfw.userEvents.head = event->next;
+        _glfw_free(event);
+    }
 
     _glfwTerminateVulkan();
     _glfw.platform.terminateJoysticks();
@@ -224,6 +242,44 @@ char** _glfwParseUriList(char* text, int* count)
     return paths;
 }
 
+// Hashes the size and pixels of an image, continuing from the specified hash
+// NOTE: This is only used to find cache candidates and matches are confirmed
+//       by comparing the pixels
+//
+uint64_t _glfwHashImage(const GLFWimage* image, uint64_t hash)
+{
+    const size_t size = (size_t) image->width * image->height * 4;
+    size_t i;
+
+    hash ^= ((uint64_t) image->width << 32) | (uint32_t) image->height;
+    hash *= 0x9e3779b97f4a7c15ull;
+    hash ^= hash >> 32;
+
+    // Pixel data is always a multiple of four bytes, so at most one half word
+    // remains after the loop
+    for (i = 0;  i + 8 <= size;  i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, image->pixels + i, sizeof(word));
+
+        hash ^= word;
+        hash *= 0x9e3779b97f4a7c15ull;
+        hash ^= hash >> 32;
+    }
+
+    if (i < size)
+    {
+        uint32_t word;
+        memcpy(&word, image->pixels + i, sizeof(word));
+
+        hash ^= word;
+        hash *= 0x9e3779b97f4a7c15ull;
+        hash ^= hash >> 32;
+    }
+
+    return hash;
+}
+
 char* _glfw_strdup(const char* source)
 {
     const size_t length = strlen(source);
@@ -438,8 +494,6 @@ GLFWAPI int glfwInit(void)
 
     _glfwPlatformSetTls(&_glfw.errorSlot, &_glfwMainThreadError);
 
-    _glfwInitGamepadMappings();
-
     _glfwPlatformInitTimer();
     _glfw.timer.offset = _glfwPlatformGetTimerValue();
 
@@ -464,6 +518,15 @@ GLFWAPI void glfwInitHint(int hint, int value)
         case GLFW_JOYSTICK_HAT_BUTTONS:
             _glfwInitHints.hatButtons = value;
             return;
+        case GLFW_JOYSTICK_SAMPLING:
+            _glfwInitHints.joystickSampling = value;
+            return;
+        case GLFW_EVENT_QUEUE:
+            _glfwInitHints.eventQueue = value;
+            return;
+        case GLFW_IMAGE_CACHE:
+            _glfwInitHints.imageCache = value;
+            return;
         case GLFW_ANGLE_PLATFORM_TYPE:
             _glfwInitHints.angleType = value;
             return;
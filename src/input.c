@@ -28,7 +28,7 @@
 //========================================================================
 
 #include "internal.h"
-#include "mappings.h"
+#include "mapping_table.h"
 
 #include <assert.h>
 #include <float.h>
@@ -39,7 +39,11 @@
 // Internal key state used for sticky keys
 #define _GLFW_STICK 3
 
+// Number of joystick samples kept per joystick when sampling is enabled
+#define _GLFW_JOYSTICK_SAMPLE_COUNT 4096
+
 // Internal constants for gamepad mapping source types
+// These must match the constants in CMake/GenerateMappingTable.cmake
 #define _GLFW_JOYSTICK_AXIS     1
 #define _GLFW_JOYSTICK_BUTTON   2
 #define _GLFW_JOYSTICK_HATBIT   3
@@ -67,67 +71,50 @@ static GLFWbool initJoysticks(void)
     return _glfw.joysticksInitialized = GLFW_TRUE;
 }
 
-// Finds a mapping based on joystick GUID
+// Updates the state of the specified joystick from the platform
+// A joystick callback may call the joystick functions while the state is being
+// updated, in which case the state applied so far is returned instead of
+// starting a nested update that the outer one would then overwrite
 //
-static _GLFWmapping* findMapping(const char* guid)
+static GLFWbool pollJoystick(_GLFWjoystick* js, int mode)
 {
-    int i;
+    GLFWbool result;
 
-    for (i = 0;  i < _glfw.mappingCount;  i++)
-    {
-        if (strcmp(_glfw.mappings[i].guid, guid) == 0)
-            return _glfw.mappings + i;
-    }
+    if (js->polling)
+        return js->connected;
 
-    return NULL;
-}
+    js->polling = GLFW_TRUE;
+    result = _glfw.platform.pollJoystick(js, mode);
+    js->polling = GLFW_FALSE;
 
-// Checks whether a gamepad mapping element is present in the hardware
-//
-static GLFWbool isValidElementForJoystick(const _GLFWmapelement* e,
-                                          const _GLFWjoystick* js)
-{
-    if (e->type == _GLFW_JOYSTICK_HATBIT && (e->index >> 4) >= js->hatCount)
-        return GLFW_FALSE;
-    else if (e->type == _GLFW_JOYSTICK_BUTTON && e->index >= js->buttonCount)
-        return GLFW_FALSE;
-    else if (e->type == _GLFW_JOYSTICK_AXIS && e->index >= js->axisCount)
-        return GLFW_FALSE;
-
-    return GLFW_TRUE;
+    return result;
 }
 
-// Finds a mapping based on joystick GUID and verifies element indices
+// Parses an unsigned decimal number, advancing the cursor past its digits
 //
-static _GLFWmapping* findValidMapping(const _GLFWjoystick* js)
+static unsigned int parseNumber(const char** c, const char* end)
 {
-    _GLFWmapping* mapping = findMapping(js->guid);
-    if (mapping)
-    {
-        int i;
+    unsigned int value = 0;
 
-        for (i = 0;  i <= GLFW_GAMEPAD_BUTTON_LAST;  i++)
-        {
-            if (!isValidElementForJoystick(mapping->buttons + i, js))
-                return NULL;
-        }
-
-        for (i = 0;  i <= GLFW_GAMEPAD_AXIS_LAST;  i++)
-        {
-            if (!isValidElementForJoystick(mapping->axes + i, js))
-                return NULL;
-        }
+    while (*c < end && **c >= '0' && **c <= '9')
+    {
+        value = value * 10 + (unsigned int) (**c - '0');
+        *c += 1;
     }
 
-    return mapping;
+    return value;
 }
 
-// Parses an SDL_GameControllerDB line and adds it to the mapping list
+// Parses an SDL_GameControllerDB line that is not necessarily terminated
 //
-static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
+static GLFWbool parseMapping(_GLFWmapping* mapping,
+                             const char* string,
+                             size_t length)
 {
     const char* c = string;
-    size_t i, length;
+    const char* end = string + length;
+    const char* next;
+    size_t i;
     struct
     {
         const char* name;
@@ -158,37 +145,44 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
         { "righty",        mapping->axes + GLFW_GAMEPAD_AXIS_RIGHT_Y }
     };
 
-    length = strcspn(c, ",");
-    if (length != 32 || c[length] != ',')
+    next = memchr(c, ',', (size_t) (end - c));
+    if (!next || next - c != 32)
     {
         _glfwInputError(GLFW_INVALID_VALUE, NULL);
         return GLFW_FALSE;
     }
 
-    memcpy(mapping->guid, c, length);
-    c += length + 1;
+    memcpy(mapping->guid, c, 32);
+    c = next + 1;
 
-    length = strcspn(c, ",");
-    if (length >= sizeof(mapping->name) || c[length] != ',')
+    next = memchr(c, ',', (size_t) (end - c));
+    if (!next || (size_t) (next - c) >= sizeof(mapping->name))
     {
         _glfwInputError(GLFW_INVALID_VALUE, NULL);
         return GLFW_FALSE;
     }
 
-    memcpy(mapping->name, c, length);
-    c += length + 1;
+    memcpy(mapping->name, c, (size_t) (next - c));
+    c = next + 1;
 
-    while (*c)
+    while (c < end)
     {
         // TODO: Implement output modifiers
         if (*c == '+' || *c == '-')
             return GLFW_FALSE;
 
+        next = memchr(c, ',', (size_t) (end - c));
+        if (!next)
+            next = end;
+
         for (i = 0;  i < sizeof(fields) / sizeof(fields[0]);  i++)
         {
-            length = strlen(fields[i].name);
-            if (strncmp(c, fields[i].name, length) != 0 || c[length] != ':')
+            const size_t length = strlen(fields[i].name);
+            if ((size_t) (next - c) <= length ||
+                memcmp(c, fields[i].name, length) != 0 || c[length] != ':')
+            {
                 continue;
+            }
 
             c += length + 1;
 
@@ -198,17 +192,20 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
                 int8_t minimum = -1;
                 int8_t maximum = 1;
 
-                if (*c == '+')
+                if (c < next && *c == '+')
                 {
                     minimum = 0;
                     c += 1;
                 }
-                else if (*c == '-')
+                else if (c < next && *c == '-')
                 {
                     maximum = 0;
                     c += 1;
                 }
 
+                if (c == next)
+                    break;
+
                 if (*c == 'a')
                     e->type = _GLFW_JOYSTICK_AXIS;
                 else if (*c == 'b')
@@ -218,21 +215,28 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
                 else
                     break;
 
+                c += 1;
+
                 if (e->type == _GLFW_JOYSTICK_HATBIT)
                 {
-                    const unsigned long hat = strtoul(c + 1, (char**) &c, 10);
-                    const unsigned long bit = strtoul(c + 1, (char**) &c, 10);
+                    unsigned int hat, bit;
+
+                    hat = parseNumber(&c, next);
+                    if (c < next)
+                        c += 1;
+                    bit = parseNumber(&c, next);
+
                     e->index = (uint8_t) ((hat << 4) | bit);
                 }
                 else
-                    e->index = (uint8_t) strtoul(c + 1, (char**) &c, 10);
+                    e->index = (uint8_t) parseNumber(&c, next);
 
                 if (e->type == _GLFW_JOYSTICK_AXIS)
                 {
                     e->axisScale = 2 / (maximum - minimum);
                     e->axisOffset = -(maximum + minimum);
 
-                    if (*c == '~')
+                    if (c < next && *c == '~')
                     {
                         e->axisScale = -e->axisScale;
                         e->axisOffset = -e->axisOffset;
@@ -242,16 +246,20 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
             else
             {
                 const char* name = _glfw.platform.getMappingName();
-                length = strlen(name);
-                if (strncmp(c, name, length) != 0)
+                const size_t nameLength = strlen(name);
+                if ((size_t) (next - c) < nameLength ||
+                    memcmp(c, name, nameLength) != 0)
+                {
                     return GLFW_FALSE;
+                }
             }
 
             break;
         }
 
-        c += strcspn(c, ",");
-        c += strspn(c, ",");
+        c = next;
+        while (c < end && *c == ',')
+            c++;
     }
 
     for (i = 0;  i < 32;  i++)
@@ -264,6 +272,472 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
     return GLFW_TRUE;
 }
 
+// Checks the platform field of an unparsed mapping line, if it has one
+//
+static GLFWbool isMappingForPlatform(const char* string, size_t length)
+{
+    const char* key = ",platform:";
+    const size_t keyLength = strlen(key);
+    const char* name = _glfw.platform.getMappingName();
+    const size_t nameLength = strlen(name);
+    size_t i;
+
+    if (length < keyLength)
+        return GLFW_TRUE;
+
+    // The platform field is almost always last, so search from the end
+    for (i = length - keyLength + 1;  i > 0;  i--)
+    {
+        const char* c = string + i - 1;
+        if (*c != ',' || memcmp(c, key, keyLength) != 0)
+            continue;
+
+        c += keyLength;
+
+        if ((size_t) (string + length - c) < nameLength)
+            return GLFW_FALSE;
+
+        return memcmp(c, name, nameLength) == 0;
+    }
+
+    return GLFW_TRUE;
+}
+
+// Returns the FNV-1a hash of a gamepad mapping GUID
+//
+static uint32_t hashMappingGUID(const char* guid)
+{
+    uint32_t hash = 2166136261u;
+
+    while (*guid)
+    {
+        hash ^= (uint8_t) *guid++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Returns the mapping index slot for the specified GUID
+// The slot is either the one holding that GUID or the empty slot ending its probe
+//
+static int* findMappingSlot(const char* guid)
+{
+    const uint32_t mask = (uint32_t) _glfw.mappingIndexSize - 1;
+    uint32_t i = hashMappingGUID(guid) & mask;
+
+    while (_glfw.mappingIndex[i])
+    {
+        if (strcmp(_glfw.mappings[_glfw.mappingIndex[i] - 1].guid, guid) == 0)
+            break;
+
+        i = (i + 1) & mask;
+    }
+
+    return _glfw.mappingIndex + i;
+}
+
+// Rebuilds the mapping index with room for at least the specified number of
+// mappings while keeping the load factor at or below one half
+//
+static void resizeMappingIndex(int count)
+{
+    int i, size = 64;
+
+    while (size < count * 2)
+        size *= 2;
+
+    _glfw_free(_glfw.mappingIndex);
+    _glfw.mappingIndex = _glfw_calloc(size, sizeof(int));
+    _glfw.mappingIndexSize = size;
+
+    for (i = 0;  i < _glfw.mappingCount;  i++)
+        *findMappingSlot(_glfw.mappings[i].guid) = i + 1;
+}
+
+// Adds a mapping to the mapping list or replaces the one with the same GUID
+//
+static void addMapping(const _GLFWmapping* mapping)
+{
+    int* slot;
+
+    if ((_glfw.mappingCount + 1) * 2 > _glfw.mappingIndexSize)
+        resizeMappingIndex(_glfw.mappingCount + 1);
+
+    slot = findMappingSlot(mapping->guid);
+    if (*slot)
+    {
+        _glfw.mappings[*slot - 1] = *mapping;
+        return;
+    }
+
+    if (_glfw.mappingCount == _glfw.mappingCapacity)
+    {
+        _glfw.mappingCapacity = _glfw_max(_glfw.mappingCapacity * 2, 64);
+        _glfw.mappings = _glfw_realloc(_glfw.mappings,
+                                       sizeof(_GLFWmapping) * _glfw.mappingCapacity);
+    }
+
+    _glfw.mappings[_glfw.mappingCount++] = *mapping;
+    *slot = _glfw.mappingCount;
+}
+
+// Compares a GUID with the GUID of a built-in mapping
+//
+static int compareDefaultMapping(const void* guid, const void* mapping)
+{
+    return strcmp((const char*) guid, ((const _GLFWmapping*) mapping)->guid);
+}
+
+// Finds a mapping based on joystick GUID
+// Mappings added at run-time take precedence over the built-in ones
+//
+static const _GLFWmapping* findMapping(const char* guid)
+{
+    if (_glfw.mappingIndexSize)
+    {
+        const int* slot = findMappingSlot(guid);
+        if (*slot)
+            return _glfw.mappings + *slot - 1;
+    }
+
+    return bsearch(guid,
+                   _glfwDefaultMappingTable,
+                   sizeof(_glfwDefaultMappingTable) / sizeof(_GLFWmapping),
+                   sizeof(_GLFWmapping),
+                   compareDefaultMapping);
+}
+
+// Checks whether a gamepad mapping element is present in the hardware
+//
+static GLFWbool isValidElementForJoystick(const _GLFWmapelement* e,
+                                          const _GLFWjoystick* js)
+{
+    if (e->type == _GLFW_JOYSTICK_HATBIT && (e->index >> 4) >= js->hatCount)
+        return GLFW_FALSE;
+    else if (e->type == _GLFW_JOYSTICK_BUTTON && e->index >= js->buttonCount)
+        return GLFW_FALSE;
+    else if (e->type == _GLFW_JOYSTICK_AXIS && e->index >= js->axisCount)
+        return GLFW_FALSE;
+
+    return GLFW_TRUE;
+}
+
+// Finds a mapping based on joystick GUID and verifies element indices
+//
+static const _GLFWmapping* findValidMapping(const _GLFWjoystick* js)
+{
+    const _GLFWmapping* mapping = findMapping(js->guid);
+    if (mapping)
+    {
+        int i;
+
+        for (i = 0;  i <= GLFW_GAMEPAD_BUTTON_LAST;  i++)
+        {
+            if (!isValidElementForJoystick(mapping->buttons + i, js))
+                return NULL;
+        }
+
+        for (i = 0;  i <= GLFW_GAMEPAD_AXIS_LAST;  i++)
+        {
+            if (!isValidElementForJoystick(mapping->axes + i, js))
+                return NULL;
+        }
+    }
+
+    return mapping;
+}
+
+// Adds a gather of the specified source type for every element using it
+//
+static void addGamepadGathers(_GLFWgamepadtransform* t,
+                              const _GLFWmapping* mapping,
+                              uint8_t type)
+{
+    int i;
+
+    for (i = 0;  i < _GLFW_GAMEPAD_ELEMENT_COUNT;  i++)
+    {
+        const _GLFWmapelement* e;
+
+        if (i <= GLFW_GAMEPAD_BUTTON_LAST)
+            e = mapping->buttons + i;
+        else
+            e = mapping->axes + i - GLFW_GAMEPAD_BUTTON_LAST - 1;
+
+        if (e->type != type)
+            continue;
+
+        t->gathers[t->gatherCount].target = (uint8_t) i;
+
+        if (type == _GLFW_JOYSTICK_HATBIT)
+        {
+            t->gathers[t->gatherCount].source = e->index >> 4;
+            t->gathers[t->gatherCount].mask = e->index & 0xf;
+        }
+        else
+            t->gathers[t->gatherCount].source = e->index;
+
+        t->gatherCount++;
+    }
+}
+
+// Compiles the mapping of the specified joystick into a transform so that
+// gamepad state evaluation does not need to interpret the mapping elements
+//
+static void compileGamepadTransform(_GLFWjoystick* js)
+{
+    int i;
+    _GLFWgamepadtransform* t = &js->gamepad;
+
+    memset(t, 0, sizeof(_GLFWgamepadtransform));
+
+    if (!js->mapping)
+        return;
+
+    addGamepadGathers(t, js->mapping, _GLFW_JOYSTICK_AXIS);
+    t->axisGatherEnd = t->gatherCount;
+    addGamepadGathers(t, js->mapping, _GLFW_JOYSTICK_BUTTON);
+    t->buttonGatherEnd = t->gatherCount;
+    addGamepadGathers(t, js->mapping, _GLFW_JOYSTICK_HATBIT);
+
+    // Button and hat bit inputs are gathered as 0.0 or 1.0
+    for (i = 0;  i <= GLFW_GAMEPAD_BUTTON_LAST;  i++)
+    {
+        const _GLFWmapelement* e = js->mapping->buttons + i;
+
+        if (e->type == _GLFW_JOYSTICK_AXIS)
+        {
+            // Axes map to buttons pressed at or past the center of their range,
+            // in the direction of the range
+            if (e->axisOffset < 0 || (e->axisOffset == 0 && e->axisScale > 0))
+            {
+                t->scales[i] = e->axisScale;
+                t->offsets[i] = e->axisOffset;
+            }
+            else
+            {
+                t->scales[i] = -e->axisScale;
+                t->offsets[i] = -e->axisOffset;
+            }
+        }
+        else if (e->type == _GLFW_JOYSTICK_BUTTON ||
+                 e->type == _GLFW_JOYSTICK_HATBIT)
+        {
+            t->scales[i] = 1.f;
+            t->offsets[i] = -0.5f;
+        }
+        else
+        {
+            t->scales[i] = 0.f;
+            t->offsets[i] = -1.f;
+        }
+    }
+
+    for (i = 0;  i <= GLFW_GAMEPAD_AXIS_LAST;  i++)
+    {
+        const _GLFWmapelement* e = js->mapping->axes + i;
+        const int element = GLFW_GAMEPAD_BUTTON_LAST + 1 + i;
+
+        if (e->type == _GLFW_JOYSTICK_AXIS)
+        {
+            t->scales[element] = e->axisScale;
+            t->offsets[element] = e->axisOffset;
+        }
+        else if (e->type == _GLFW_JOYSTICK_BUTTON ||
+                 e->type == _GLFW_JOYSTICK_HATBIT)
+        {
+            t->scales[element] = 2.f;
+            t->offsets[element] = -1.f;
+        }
+    }
+}
+
+// Finds a valid mapping for the specified joystick and compiles it
+//
+static void updateJoystickMapping(_GLFWjoystick* js)
+{
+    js->mapping = findValidMapping(js);
+    compileGamepadTransform(js);
+}
+
+// Evaluates the compiled mapping of the specified joystick
+//
+static void evaluateGamepadTransform(const _GLFWjoystick* js,
+                                     GLFWgamepadstate* state)
+{
+    int i;
+    const _GLFWgamepadtransform* t = &js->gamepad;
+    float inputs[_GLFW_GAMEPAD_ELEMENT_COUNT] = {0};
+
+    for (i = 0;  i < t->axisGatherEnd;  i++)
+        inputs[t->gathers[i].target] = js->axes[t->gathers[i].source];
+
+    for (;  i < t->buttonGatherEnd;  i++)
+        inputs[t->gathers[i].target] = js->buttons[t->gathers[i].source];
+
+    for (;  i < t->gatherCount;  i++)
+    {
+        const unsigned char hat = js->hats[t->gathers[i].source];
+        inputs[t->gathers[i].target] = (float) ((hat & t->gathers[i].mask) != 0);
+    }
+
+    for (i = 0;  i < _GLFW_GAMEPAD_ELEMENT_COUNT;  i++)
+        inputs[i] = inputs[i] * t->scales[i] + t->offsets[i];
+
+    for (i = 0;  i <= GLFW_GAMEPAD_BUTTON_LAST;  i++)
+        state->buttons[i] = inputs[i] >= 0.f ? GLFW_PRESS : GLFW_RELEASE;
+
+    for (i = 0;  i <= GLFW_GAMEPAD_AXIS_LAST;  i++)
+    {
+        const float value = inputs[GLFW_GAMEPAD_BUTTON_LAST + 1 + i];
+        state->axes[i] = _glfw_fminf(_glfw_fmaxf(value, -1.f), 1.f);
+    }
+}
+
+// Parses and adds every mapping line in the specified buffer, which does not
+// need to be terminated, and then updates the mappings of connected joysticks
+//
+static void updateGamepadMappings(const char* string, size_t length)
+{
+    int jid;
+    const char* c = string;
+    const char* end = string + length;
+
+    while (c < end)
+    {
+        const char* next = c;
+        while (next < end && *next != '\r' && *next != '\n')
+            next++;
+
+        if ((*c >= '0' && *c <= '9') ||
+            (*c >= 'a' && *c <= 'f') ||
+            (*c >= 'A' && *c <= 'F'))
+        {
+            if (isMappingForPlatform(c, (size_t) (next - c)))
+            {
+                _GLFWmapping mapping = {{0}};
+
+                if (parseMapping(&mapping, c, (size_t) (next - c)))
+                    addMapping(&mapping);
+            }
+        }
+
+        c = next;
+        while (c < end && (*c == '\r' || *c == '\n'))
+            c++;
+    }
+
+    for (jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+    {
+        _GLFWjoystick* js = _glfw.joysticks + jid;
+        if (js->connected)
+            updateJoystickMapping(js);
+    }
+}
+
+
+// Updates the time of the input event being reported
+//
+static void updateEventTime(void)
+{
+    if (_glfw.eventTime.source)
+        _glfw.eventTime.current = _glfw.eventTime.source;
+    else
+        _glfw.eventTime.current = _glfwPlatformGetTimerValue();
+}
+
+// Appends a record of the specified type to the input event queue
+// Returns NULL if the event queue is disabled or could not be grown
+//
+static GLFWevent* queueEvent(_GLFWwindow* window, int type)
+{
+    GLFWevent* event;
+    const int current = _glfw.eventQueue.current;
+
+    if (!_glfw.hints.init.eventQueue)
+        return NULL;
+
+    if (_glfw.eventQueue.count == _glfw.eventQueue.capacity[current])
+    {
+        GLFWevent* events;
+        const int capacity = _glfw_max(256, _glfw.eventQueue.count * 2);
+
+        events = _glfw_realloc(_glfw.eventQueue.events[current],
+                               capacity * sizeof(GLFWevent));
+        if (!events)
+            return NULL;
+
+        _glfw.eventQueue.events[current] = events;
+        _glfw.eventQueue.capacity[current] = capacity;
+    }
+
+    event = _glfw.eventQueue.events[current] + _glfw.eventQueue.count++;
+    memset(event, 0, sizeof(GLFWevent));
+    event->type = type;
+    event->time = (double) (_glfw.eventTime.current - _glfw.timer.offset) /
+        _glfwPlatformGetTimerFrequency();
+    event->window = (GLFWwindow*) window;
+    return event;
+}
+
+// Appends a cursor position or scroll offset to the cursor history of the window
+//
+static void recordCursorSample(_GLFWwindow* window, int type, double x, double y)
+{
+    GLFWcursorsample* sample;
+
+    if (window->cursorSampleCount == window->cursorSampleCapacity)
+    {
+        GLFWcursorsample* samples;
+        const int capacity = _glfw_max(64, window->cursorSampleCount * 2);
+
+        samples = _glfw_realloc(window->cursorSamples,
+                                capacity * sizeof(GLFWcursorsample));
+        if (!samples)
+            return;
+
+        window->cursorSamples = samples;
+        window->cursorSampleCapacity = capacity;
+    }
+
+    sample = window->cursorSamples + window->cursorSampleCount++;
+    sample->type = type;
+    sample->time = (double) (_glfw.eventTime.current - _glfw.timer.offset) /
+        _glfwPlatformGetTimerFrequency();
+    sample->x = x;
+    sample->y = y;
+}
+
+// Reports a cursor position to the event queue and cursor position callback
+//
+static void reportCursorPos(_GLFWwindow* window, double xpos, double ypos)
+{
+    GLFWevent* event;
+
+    event = queueEvent(window, GLFW_EVENT_CURSOR_POS);
+    if (event)
+    {
+        event->x = xpos;
+        event->y = ypos;
+    }
+
+    if (window->callbacks.cursorPos)
+        window->callbacks.cursorPos((GLFWwindow*) window, xpos, ypos);
+}
+
+// Reports any cursor position held back by cursor motion coalescing
+//
+static void flushCursorMotion(_GLFWwindow* window)
+{
+    if (!window->cursorPending)
+        return;
+
+    window->cursorPending = GLFW_FALSE;
+    _glfw.eventTime.current = window->cursorPendingTime;
+    reportCursorPos(window, window->virtualCursorPosX, window->virtualCursorPosY);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
@@ -273,6 +747,8 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
 //
 void _glfwInputKey(_GLFWwindow* window, int key, int scancode, int action, int mods)
 {
+    GLFWevent* event;
+
     assert(window != NULL);
     assert(key >= 0 || key == GLFW_KEY_UNKNOWN);
     assert(key <= GLFW_KEY_LAST);
@@ -301,6 +777,17 @@ void _glfwInputKey(_GLFWwindow* window, int key, int scancode, int action, int m
     if (!window->lockKeyMods)
         mods &= ~(GLFW_MOD_CAPS_LOCK | GLFW_MOD_NUM_LOCK);
 
+    updateEventTime();
+
+    event = queueEvent(window, GLFW_EVENT_KEY);
+    if (event)
+    {
+        event->key = key;
+        event->scancode = scancode;
+        event->action = action;
+        event->mods = mods;
+    }
+
     if (window->callbacks.key)
         window->callbacks.key((GLFWwindow*) window, key, scancode, action, mods);
 }
@@ -320,11 +807,20 @@ void _glfwInputChar(_GLFWwindow* window, uint32_t codepoint, int mods, GLFWbool
     if (!window->lockKeyMods)
         mods &= ~(GLFW_MOD_CAPS_LOCK | GLFW_MOD_NUM_LOCK);
 
+    updateEventTime();
+
     if (window->callbacks.charmods)
         window->callbacks.charmods((GLFWwindow*) window, codepoint, mods);
 
     if (plain)
     {
+        GLFWevent* event = queueEvent(window, GLFW_EVENT_CHAR);
+        if (event)
+        {
+            event->codepoint = codepoint;
+            event->mods = mods;
+        }
+
         if (window->callbacks.character)
             window->callbacks.character((GLFWwindow*) window, codepoint);
     }
@@ -334,12 +830,27 @@ void _glfwInputChar(_GLFWwindow* window, uint32_t codepoint, int mods, GLFWbool
 //
 void _glfwInputScroll(_GLFWwindow* window, double xoffset, double yoffset)
 {
+    GLFWevent* event;
+
     assert(window != NULL);
     assert(xoffset > -FLT_MAX);
     assert(xoffset < FLT_MAX);
     assert(yoffset > -FLT_MAX);
     assert(yoffset < FLT_MAX);
 
+    flushCursorMotion(window);
+    updateEventTime();
+
+    if (window->callbacks.cursorHistory)
+        recordCursorSample(window, GLFW_EVENT_SCROLL, xoffset, yoffset);
+
+    event = queueEvent(window, GLFW_EVENT_SCROLL);
+    if (event)
+    {
+        event->x = xoffset;
+        event->y = yoffset;
+    }
+
     if (window->callbacks.scroll)
         window->callbacks.scroll((GLFWwindow*) window, xoffset, yoffset);
 }
@@ -348,6 +859,8 @@ void _glfwInputScroll(_GLFWwindow* window, double xoffset, double yoffset)
 //
 void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
 {
+    GLFWevent* event;
+
     assert(window != NULL);
     assert(button >= 0);
     assert(button <= GLFW_MOUSE_BUTTON_LAST);
@@ -365,6 +878,17 @@ void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
     else
         window->mouseButtons[button] = (char) action;
 
+    flushCursorMotion(window);
+    updateEventTime();
+
+    event = queueEvent(window, GLFW_EVENT_MOUSE_BUTTON);
+    if (event)
+    {
+        event->button = button;
+        event->action = action;
+        event->mods = mods;
+    }
+
     if (window->callbacks.mouseButton)
         window->callbacks.mouseButton((GLFWwindow*) window, button, action, mods);
 }
@@ -386,17 +910,38 @@ void _glfwInputCursorPos(_GLFWwindow* window, double xpos, double ypos)
     window->virtualCursorPosX = xpos;
     window->virtualCursorPosY = ypos;
 
-    if (window->callbacks.cursorPos)
-        window->callbacks.cursorPos((GLFWwindow*) window, xpos, ypos);
+    updateEventTime();
+
+    if (window->callbacks.cursorHistory)
+        recordCursorSample(window, GLFW_EVENT_CURSOR_POS, xpos, ypos);
+
+    if (window->cursorCoalescing)
+    {
+        window->cursorPending = GLFW_TRUE;
+        window->cursorPendingTime = _glfw.eventTime.current;
+        return;
+    }
+
+    window->cursorPending = GLFW_FALSE;
+    reportCursorPos(window, xpos, ypos);
 }
 
 // Notifies shared code of a cursor enter/leave event
 //
 void _glfwInputCursorEnter(_GLFWwindow* window, GLFWbool entered)
 {
+    GLFWevent* event;
+
     assert(window != NULL);
     assert(entered == GLFW_TRUE || entered == GLFW_FALSE);
 
+    flushCursorMotion(window);
+    updateEventTime();
+
+    event = queueEvent(window, GLFW_EVENT_CURSOR_ENTER);
+    if (event)
+        event->action = entered;
+
     if (window->callbacks.cursorEnter)
         window->callbacks.cursorEnter((GLFWwindow*) window, entered);
 }
@@ -409,10 +954,21 @@ void _glfwInputDrop(_GLFWwindow* window, int count, const char** paths)
     assert(count > 0);
     assert(paths != NULL);
 
+    updateEventTime();
+
     if (window->callbacks.drop)
         window->callbacks.drop((GLFWwindow*) window, count, paths);
 }
 
+// Notifies shared code of the time of the native event being processed, as
+// a timer value, or that its time is unknown if zero
+// The time applies to all input reported until it is changed
+//
+void _glfwInputEventTime(uint64_t value)
+{
+    _glfw.eventTime.source = value;
+}
+
 // Notifies shared code of a joystick connection or disconnection
 //
 void _glfwInputJoystick(_GLFWjoystick* js, int event)
@@ -433,11 +989,37 @@ void _glfwInputJoystick(_GLFWjoystick* js, int event)
 //
 void _glfwInputJoystickAxis(_GLFWjoystick* js, int axis, float value)
 {
+    float deadzone;
+
     assert(js != NULL);
     assert(axis >= 0);
     assert(axis < js->axisCount);
 
+    deadzone = js->deadzone;
+    if (deadzone < 0.f)
+        deadzone = js->deviceDeadzones[axis];
+
+    if (fabs(value) <= deadzone)
+        value = 0.f;
+
+    // Ignore changes smaller than the fuzz unless the axis reaches its center
+    // or either end, so that those positions can always be reported
+    if (fabs(value - js->axes[axis]) < js->fuzz &&
+        value != 0.f && value != -1.f && value != 1.f)
+    {
+        return;
+    }
+
+    if (js->axes[axis] == value)
+        return;
+
     js->axes[axis] = value;
+    updateEventTime();
+
+    // The initial state of a joystick is applied before it is reported as
+    // connected and is only visible through the state functions
+    if (js->connected && _glfw.callbacks.joystickAxis)
+        _glfw.callbacks.joystickAxis((int) (js - _glfw.joysticks), axis, value);
 }
 
 // Notifies shared code of the new value of a joystick button
@@ -449,14 +1031,22 @@ void _glfwInputJoystickButton(_GLFWjoystick* js, int button, char value)
     assert(button < js->buttonCount);
     assert(value == GLFW_PRESS || value == GLFW_RELEASE);
 
+    if (js->buttons[button] == value)
+        return;
+
     js->buttons[button] = value;
+    updateEventTime();
+
+    if (js->connected && _glfw.callbacks.joystickButton)
+        _glfw.callbacks.joystickButton((int) (js - _glfw.joysticks), button, value);
 }
 
 // Notifies shared code of the new value of a joystick hat
 //
 void _glfwInputJoystickHat(_GLFWjoystick* js, int hat, char value)
 {
-    int base;
+    int i, base, changed = 0;
+    const int jid = (int) (js - _glfw.joysticks);
 
     assert(js != NULL);
     assert(hat >= 0);
@@ -467,36 +1057,80 @@ void _glfwInputJoystickHat(_GLFWjoystick* js, int hat, char value)
     assert((value & 0xf0) == 0);
     assert((value & ((value << 2) | (value >> 2))) == 0);
 
-    base = js->buttonCount + hat * 4;
+    if (js->hats[hat] == value)
+        return;
 
-    js->buttons[base + 0] = (value & 0x01) ? GLFW_PRESS : GLFW_RELEASE;
-    js->buttons[base + 1] = (value & 0x02) ? GLFW_PRESS : GLFW_RELEASE;
-    js->buttons[base + 2] = (value & 0x04) ? GLFW_PRESS : GLFW_RELEASE;
-    js->buttons[base + 3] = (value & 0x08) ? GLFW_PRESS : GLFW_RELEASE;
+    updateEventTime();
 
+    // Update the hat and its buttons before any callback so that the state
+    // functions agree with what is being reported
     js->hats[hat] = value;
-}
 
+    base = js->buttonCount + hat * 4;
 
-//////////////////////////////////////////////////////////////////////////
-//////                       GLFW internal API                      //////
-//////////////////////////////////////////////////////////////////////////
+    for (i = 0;  i < 4;  i++)
+    {
+        const char action = (value & (1 << i)) ? GLFW_PRESS : GLFW_RELEASE;
+        if (js->buttons[base + i] == action)
+            continue;
+
+        js->buttons[base + i] = action;
+        changed |= 1 << i;
+    }
+
+    if (!js->connected)
+        return;
+
+    // Hat buttons are only visible when hats are exposed as buttons
+    if (_glfw.callbacks.joystickButton && _glfw.hints.init.hatButtons)
+    {
+        for (i = 0;  i < 4;  i++)
+        {
+            if (changed & (1 << i))
+                _glfw.callbacks.joystickButton(jid, base + i, js->buttons[base + i]);
+        }
+    }
 
-// Adds the built-in set of gamepad mappings
+    if (_glfw.callbacks.joystickHat)
+        _glfw.callbacks.joystickHat(jid, hat, value);
+}
+
+// Notifies shared code of a timestamped change to a joystick element
+// The oldest sample is discarded if the history is full
 //
-void _glfwInitGamepadMappings(void)
+void _glfwInputJoystickSample(_GLFWjoystick* js,
+                              int type, int index, float value, double time)
 {
-    size_t i;
-    const size_t count = sizeof(_glfwDefaultMappings) / sizeof(char*);
-    _glfw.mappings = _glfw_calloc(count, sizeof(_GLFWmapping));
+    GLFWjoysticksample* sample;
 
-    for (i = 0;  i < count;  i++)
+    assert(js != NULL);
+    assert(type == GLFW_JOYSTICK_SAMPLE_AXIS ||
+           type == GLFW_JOYSTICK_SAMPLE_BUTTON ||
+           type == GLFW_JOYSTICK_SAMPLE_HAT);
+
+    if (!js->samples)
+        return;
+
+    if (js->sampleCount == _GLFW_JOYSTICK_SAMPLE_COUNT)
     {
-        if (parseMapping(&_glfw.mappings[_glfw.mappingCount], _glfwDefaultMappings[i]))
-            _glfw.mappingCount++;
+        js->sampleFirst = (js->sampleFirst + 1) % _GLFW_JOYSTICK_SAMPLE_COUNT;
+        js->sampleCount--;
     }
+
+    sample = js->samples +
+        (js->sampleFirst + js->sampleCount) % _GLFW_JOYSTICK_SAMPLE_COUNT;
+    sample->time = time;
+    sample->type = type;
+    sample->index = index;
+    sample->value = value;
+    js->sampleCount++;
 }
 
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
 // Returns an available joystick object with arrays and name allocated
 //
 _GLFWjoystick* _glfwAllocJoystick(const char* name,
@@ -520,15 +1154,22 @@ _GLFWjoystick* _glfwAllocJoystick(const char* name,
     js = _glfw.joysticks + jid;
     js->allocated   = GLFW_TRUE;
     js->axes        = _glfw_calloc(axisCount, sizeof(float));
+    js->deviceDeadzones = _glfw_calloc(axisCount, sizeof(float));
     js->buttons     = _glfw_calloc(buttonCount + (size_t) hatCount * 4, 1);
     js->hats        = _glfw_calloc(hatCount, 1);
     js->axisCount   = axisCount;
     js->buttonCount = buttonCount;
     js->hatCount    = hatCount;
 
+    if (_glfw.hints.init.joystickSampling)
+    {
+        js->samples = _glfw_calloc(_GLFW_JOYSTICK_SAMPLE_COUNT,
+                                   sizeof(GLFWjoysticksample));
+    }
+
     strncpy(js->name, name, sizeof(js->name) - 1);
     strncpy(js->guid, guid, sizeof(js->guid) - 1);
-    js->mapping = findValidMapping(js);
+    updateJoystickMapping(js);
 
     return js;
 }
@@ -538,8 +1179,10 @@ _GLFWjoystick* _glfwAllocJoystick(const char* name,
 void _glfwFreeJoystick(_GLFWjoystick* js)
 {
     _glfw_free(js->axes);
+    _glfw_free(js->deviceDeadzones);
     _glfw_free(js->buttons);
     _glfw_free(js->hats);
+    _glfw_free(js->samples);
     memset(js, 0, sizeof(_GLFWjoystick));
 }
 
@@ -553,6 +1196,69 @@ void _glfwCenterCursorInContentArea(_GLFWwindow* window)
     _glfw.platform.setCursorPos(window, width / 2.0, height / 2.0);
 }
 
+// Reports cursor motion and history held back until the end of event processing
+//
+void _glfwFlushPendingInput(void)
+{
+    _GLFWwindow* window;
+
+    for (window = _glfw.windowListHead;  window;  window = window->next)
+    {
+        flushCursorMotion(window);
+
+        if (window->cursorSampleCount)
+        {
+            const int count = window->cursorSampleCount;
+            window->cursorSampleCount = 0;
+
+            if (window->callbacks.cursorHistory)
+            {
+                window->callbacks.cursorHistory((GLFWwindow*) window,
+                                                window->cursorSamples,
+                                                count);
+            }
+        }
+    }
+}
+
+// Converts a native 32-bit millisecond timestamp with an unknown time base, as
+// used by X11, Wayland and Win32 input events, to a timer value
+//
+// The offset between the two clocks is estimated as the smallest difference
+// seen so far, i.e. that of the event delivered with the least latency
+//
+uint64_t _glfwMillisecondsToTimerValue(uint32_t milliseconds)
+{
+    int64_t extended, difference;
+    const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+    const uint64_t now = _glfwPlatformGetTimerValue();
+    const int64_t nowMS = (int64_t) (now / frequency * 1000 +
+                                     now % frequency * 1000 / frequency);
+
+    // Extend the timestamp to 64 bits to survive it wrapping around
+    if (_glfw.eventTime.estimated)
+    {
+        extended = _glfw.eventTime.last +
+            (int32_t) (milliseconds - (uint32_t) _glfw.eventTime.last);
+    }
+    else
+        extended = milliseconds;
+
+    difference = nowMS - extended;
+
+    if (!_glfw.eventTime.estimated || difference < _glfw.eventTime.offset)
+    {
+        _glfw.eventTime.offset = difference;
+        _glfw.eventTime.estimated = GLFW_TRUE;
+    }
+
+    if (extended > _glfw.eventTime.last)
+        _glfw.eventTime.last = extended;
+
+    return (uint64_t) (extended + _glfw.eventTime.offset) / 1000 * frequency +
+        (uint64_t) (extended + _glfw.eventTime.offset) % 1000 * frequency / 1000;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW public API                       //////
@@ -577,6 +1283,8 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* handle, int mode)
             return window->lockKeyMods;
         case GLFW_RAW_MOUSE_MOTION:
             return window->rawMouseMotion;
+        case GLFW_CURSOR_COALESCING:
+            return window->cursorCoalescing;
     }
 
     _glfwInputError(GLFW_INVALID_ENUM, "Invalid input mode 0x%08X", mode);
@@ -684,6 +1392,10 @@ GLFWAPI void glfwSetInputMode(GLFWwindow* handle, int mode, int value)
             _glfw.platform.setRawMouseMotion(window, value);
             return;
         }
+
+        case GLFW_CURSOR_COALESCING:
+            window->cursorCoalescing = value ? GLFW_TRUE : GLFW_FALSE;
+            return;
     }
 
     _glfwInputError(GLFW_INVALID_ENUM, "Invalid input mode 0x%08X", mode);
@@ -831,6 +1543,8 @@ GLFWAPI void glfwSetCursorPos(GLFWwindow* handle, double xpos, double ypos)
 GLFWAPI GLFWcursor* glfwCreateCursor(const GLFWimage* image, int xhot, int yhot)
 {
     _GLFWcursor* cursor;
+    uint64_t hash = 0;
+    size_t size;
 
     assert(image != NULL);
     assert(image->pixels != NULL);
@@ -843,6 +1557,30 @@ GLFWAPI GLFWcursor* glfwCreateCursor(const GLFWimage* image, int xhot, int yhot)
         return NULL;
     }
 
+    size = (size_t) image->width * image->height * 4;
+
+    if (_glfw.hints.init.imageCache)
+    {
+        hash = _glfwHashImage(image, ((uint64_t) (unsigned int) xhot << 32) |
+                                     (unsigned int) yhot);
+
+        // Return an existing cursor created from an identical image and hotspot
+        for (cursor = _glfw.cursorListHead;  cursor;  cursor = cursor->next)
+        {
+            if (cursor->image.pixels &&
+                cursor->hash == hash &&
+                cursor->xhot == xhot &&
+                cursor->yhot == yhot &&
+                cursor->image.width == image->width &&
+                cursor->image.height == image->height &&
+                memcmp(cursor->image.pixels, image->pixels, size) == 0)
+            {
+                cursor->references++;
+                return (GLFWcursor*) cursor;
+            }
+        }
+    }
+
     cursor = _glfw_calloc(1, sizeof(_GLFWcursor));
     cursor->next = _glfw.cursorListHead;
     _glfw.cursorListHead = cursor;
@@ -853,6 +1591,75 @@ GLFWAPI GLFWcursor* glfwCreateCursor(const GLFWimage* image, int xhot, int yhot)
         return NULL;
     }
 
+    if (_glfw.hints.init.imageCache)
+    {
+        cursor->hash = hash;
+        cursor->xhot = xhot;
+        cursor->yhot = yhot;
+        cursor->image.width = image->width;
+        cursor->image.height = image->height;
+        cursor->image.pixels = _glfw_calloc(size, 1);
+        memcpy(cursor->image.pixels, image->pixels, size);
+    }
+
+    return (GLFWcursor*) cursor;
+}
+
+GLFWAPI GLFWcursor* glfwCreateAnimatedCursor(const GLFWimage* images,
+                                             int count,
+                                             const double* delays,
+                                             int xhot, int yhot)
+{
+    int i;
+    _GLFWcursor* cursor;
+
+    assert(images != NULL);
+    assert(delays != NULL);
+    assert(count > 0);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    if (count <= 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid frame count %i for animated cursor",
+                        count);
+        return NULL;
+    }
+
+    for (i = 0;  i < count;  i++)
+    {
+        assert(images[i].pixels != NULL);
+
+        if (images[i].width <= 0 || images[i].height <= 0)
+        {
+            _glfwInputError(GLFW_INVALID_VALUE,
+                            "Invalid image dimensions for cursor frame %i",
+                            i);
+            return NULL;
+        }
+
+        // Delays must fit in the 32-bit millisecond fields used by Xcursor
+        if (!(delays[i] > 0.0) || delays[i] > 4294967.0)
+        {
+            _glfwInputError(GLFW_INVALID_VALUE,
+                            "Invalid delay %f for cursor frame %i",
+                            delays[i], i);
+            return NULL;
+        }
+    }
+
+    cursor = _glfw_calloc(1, sizeof(_GLFWcursor));
+    cursor->next = _glfw.cursorListHead;
+    _glfw.cursorListHead = cursor;
+
+    if (!_glfw.platform.createAnimatedCursor(cursor, images, count, delays,
+                                             xhot, yhot))
+    {
+        glfwDestroyCursor((GLFWcursor*) cursor);
+        return NULL;
+    }
+
     return (GLFWcursor*) cursor;
 }
 
@@ -899,6 +1706,13 @@ GLFWAPI void glfwDestroyCursor(GLFWcursor* handle)
     if (cursor == NULL)
         return;
 
+    // Cached cursors are only destroyed when their last handle is
+    if (cursor->references)
+    {
+        cursor->references--;
+        return;
+    }
+
     // Make sure the cursor is not being used by any window
     {
         _GLFWwindow* window;
@@ -922,6 +1736,7 @@ GLFWAPI void glfwDestroyCursor(GLFWcursor* handle)
         *prev = cursor->next;
     }
 
+    _glfw_free(cursor->image.pixels);
     _glfw_free(cursor);
 }
 
@@ -990,6 +1805,17 @@ GLFWAPI GLFWcursorposfun glfwSetCursorPosCallback(GLFWwindow* handle,
     return cbfun;
 }
 
+GLFWAPI GLFWcursorhistoryfun glfwSetCursorHistoryCallback(GLFWwindow* handle,
+                                                          GLFWcursorhistoryfun cbfun)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    _GLFW_SWAP(GLFWcursorhistoryfun, window->callbacks.cursorHistory, cbfun);
+    return cbfun;
+}
+
 GLFWAPI GLFWcursorenterfun glfwSetCursorEnterCallback(GLFWwindow* handle,
                                                       GLFWcursorenterfun cbfun)
 {
@@ -1044,7 +1870,7 @@ GLFWAPI int glfwJoystickPresent(int jid)
     if (!js->connected)
         return GLFW_FALSE;
 
-    return _glfw.platform.pollJoystick(js, _GLFW_POLL_PRESENCE);
+    return pollJoystick(js, _GLFW_POLL_PRESENCE);
 }
 
 GLFWAPI const float* glfwGetJoystickAxes(int jid, int* count)
@@ -1072,13 +1898,57 @@ GLFWAPI const float* glfwGetJoystickAxes(int jid, int* count)
     if (!js->connected)
         return NULL;
 
-    if (!_glfw.platform.pollJoystick(js, _GLFW_POLL_AXES))
+    if (!pollJoystick(js, _GLFW_POLL_AXES))
         return NULL;
 
     *count = js->axisCount;
     return js->axes;
 }
 
+GLFWAPI void glfwSetJoystickAxisFilter(int jid, float deadzone, float fuzz)
+{
+    int i;
+    _GLFWjoystick* js;
+
+    assert(jid >= GLFW_JOYSTICK_1);
+    assert(jid <= GLFW_JOYSTICK_LAST);
+
+    _GLFW_REQUIRE_INIT();
+
+    if (jid < 0 || jid > GLFW_JOYSTICK_LAST)
+    {
+        _glfwInputError(GLFW_INVALID_ENUM, "Invalid joystick ID %i", jid);
+        return;
+    }
+
+    // NOTE: These are written to also reject NaN
+    if (deadzone != GLFW_DONT_CARE && !(deadzone >= 0.f && deadzone < 1.f))
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid joystick deadzone %f", deadzone);
+        return;
+    }
+
+    if (!(fuzz >= 0.f && fuzz <= 2.f))
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid joystick fuzz %f", fuzz);
+        return;
+    }
+
+    if (!initJoysticks())
+        return;
+
+    js = _glfw.joysticks + jid;
+    if (!js->connected)
+        return;
+
+    js->deadzone = deadzone;
+    js->fuzz = fuzz;
+
+    // Apply the new deadzone to the current axis positions
+    for (i = 0;  i < js->axisCount;  i++)
+        _glfwInputJoystickAxis(js, i, js->axes[i]);
+}
+
 GLFWAPI const unsigned char* glfwGetJoystickButtons(int jid, int* count)
 {
     _GLFWjoystick* js;
@@ -1104,7 +1974,7 @@ GLFWAPI const unsigned char* glfwGetJoystickButtons(int jid, int* count)
     if (!js->connected)
         return NULL;
 
-    if (!_glfw.platform.pollJoystick(js, _GLFW_POLL_BUTTONS))
+    if (!pollJoystick(js, _GLFW_POLL_BUTTONS))
         return NULL;
 
     if (_glfw.hints.init.hatButtons)
@@ -1140,7 +2010,7 @@ GLFWAPI const unsigned char* glfwGetJoystickHats(int jid, int* count)
     if (!js->connected)
         return NULL;
 
-    if (!_glfw.platform.pollJoystick(js, _GLFW_POLL_BUTTONS))
+    if (!pollJoystick(js, _GLFW_POLL_BUTTONS))
         return NULL;
 
     *count = js->hatCount;
@@ -1169,7 +2039,7 @@ GLFWAPI const char* glfwGetJoystickName(int jid)
     if (!js->connected)
         return NULL;
 
-    if (!_glfw.platform.pollJoystick(js, _GLFW_POLL_PRESENCE))
+    if (!pollJoystick(js, _GLFW_POLL_PRESENCE))
         return NULL;
 
     return js->name;
@@ -1197,7 +2067,7 @@ GLFWAPI const char* glfwGetJoystickGUID(int jid)
     if (!js->connected)
         return NULL;
 
-    if (!_glfw.platform.pollJoystick(js, _GLFW_POLL_PRESENCE))
+    if (!pollJoystick(js, _GLFW_POLL_PRESENCE))
         return NULL;
 
     return js->guid;
@@ -1246,63 +2116,110 @@ GLFWAPI GLFWjoystickfun glfwSetJoystickCallback(GLFWjoystickfun cbfun)
     return cbfun;
 }
 
-GLFWAPI int glfwUpdateGamepadMappings(const char* string)
+GLFWAPI GLFWjoystickaxisfun glfwSetJoystickAxisCallback(GLFWjoystickaxisfun cbfun)
 {
-    int jid;
-    const char* c = string;
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
-    assert(string != NULL);
+    if (!initJoysticks())
+        return NULL;
 
-    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+    _GLFW_SWAP(GLFWjoystickaxisfun, _glfw.callbacks.joystickAxis, cbfun);
+    return cbfun;
+}
 
-    while (*c)
-    {
-        if ((*c >= '0' && *c <= '9') ||
-            (*c >= 'a' && *c <= 'f') ||
-            (*c >= 'A' && *c <= 'F'))
-        {
-            char line[1024];
+GLFWAPI GLFWjoystickbuttonfun glfwSetJoystickButtonCallback(GLFWjoystickbuttonfun cbfun)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
-            const size_t length = strcspn(c, "\r\n");
-            if (length < sizeof(line))
-            {
-                _GLFWmapping mapping = {{0}};
+    if (!initJoysticks())
+        return NULL;
 
-                memcpy(line, c, length);
-                line[length] = '\0';
+    _GLFW_SWAP(GLFWjoystickbuttonfun, _glfw.callbacks.joystickButton, cbfun);
+    return cbfun;
+}
 
-                if (parseMapping(&mapping, line))
-                {
-                    _GLFWmapping* previous = findMapping(mapping.guid);
-                    if (previous)
-                        *previous = mapping;
-                    else
-                    {
-                        _glfw.mappingCount++;
-                        _glfw.mappings =
-                            _glfw_realloc(_glfw.mappings,
-                                          sizeof(_GLFWmapping) * _glfw.mappingCount);
-                        _glfw.mappings[_glfw.mappingCount - 1] = mapping;
-                    }
-                }
-            }
+GLFWAPI GLFWjoystickhatfun glfwSetJoystickHatCallback(GLFWjoystickhatfun cbfun)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
 
-            c += length;
-        }
-        else
-        {
-            c += strcspn(c, "\r\n");
-            c += strspn(c, "\r\n");
-        }
+    if (!initJoysticks())
+        return NULL;
+
+    _GLFW_SWAP(GLFWjoystickhatfun, _glfw.callbacks.joystickHat, cbfun);
+    return cbfun;
+}
+
+GLFWAPI int glfwGetJoystickSamples(int jid, GLFWjoysticksample* samples, int count)
+{
+    int i;
+    _GLFWjoystick* js;
+
+    assert(jid >= GLFW_JOYSTICK_1);
+    assert(jid <= GLFW_JOYSTICK_LAST);
+    assert(samples != NULL);
+    assert(count >= 0);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (jid < 0 || jid > GLFW_JOYSTICK_LAST)
+    {
+        _glfwInputError(GLFW_INVALID_ENUM, "Invalid joystick ID %i", jid);
+        return 0;
     }
 
-    for (jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+    if (count < 0)
     {
-        _GLFWjoystick* js = _glfw.joysticks + jid;
-        if (js->connected)
-            js->mapping = findValidMapping(js);
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid sample count %i", count);
+        return 0;
+    }
+
+    if (!initJoysticks())
+        return 0;
+
+    js = _glfw.joysticks + jid;
+    if (!js->connected)
+        return 0;
+
+    if (!pollJoystick(js, _GLFW_POLL_ALL))
+        return 0;
+
+    count = _glfw_min(count, js->sampleCount);
+
+    for (i = 0;  i < count;  i++)
+    {
+        samples[i] = js->samples[js->sampleFirst];
+        js->sampleFirst = (js->sampleFirst + 1) % _GLFW_JOYSTICK_SAMPLE_COUNT;
     }
 
+    js->sampleCount -= count;
+    return count;
+}
+
+GLFWAPI int glfwUpdateGamepadMappings(const char* string)
+{
+    assert(string != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    updateGamepadMappings(string, strlen(string));
+    return GLFW_TRUE;
+}
+
+GLFWAPI int glfwLoadGamepadMappingsFile(const char* path)
+{
+    void* data;
+    size_t size;
+
+    assert(path != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    if (!_glfwPlatformMapFile(path, &data, &size))
+        return GLFW_FALSE;
+
+    updateGamepadMappings(data, size);
+
+    _glfwPlatformUnmapFile(data, size);
     return GLFW_TRUE;
 }
 
@@ -1328,7 +2245,7 @@ GLFWAPI int glfwJoystickIsGamepad(int jid)
     if (!js->connected)
         return GLFW_FALSE;
 
-    if (!_glfw.platform.pollJoystick(js, _GLFW_POLL_PRESENCE))
+    if (!pollJoystick(js, _GLFW_POLL_PRESENCE))
         return GLFW_FALSE;
 
     return js->mapping != NULL;
@@ -1356,7 +2273,7 @@ GLFWAPI const char* glfwGetGamepadName(int jid)
     if (!js->connected)
         return NULL;
 
-    if (!_glfw.platform.pollJoystick(js, _GLFW_POLL_PRESENCE))
+    if (!pollJoystick(js, _GLFW_POLL_PRESENCE))
         return NULL;
 
     if (!js->mapping)
@@ -1367,7 +2284,6 @@ GLFWAPI const char* glfwGetGamepadName(int jid)
 
 GLFWAPI int glfwGetGamepadState(int jid, GLFWgamepadstate* state)
 {
-    int i;
     _GLFWjoystick* js;
 
     assert(jid >= GLFW_JOYSTICK_1);
@@ -1391,64 +2307,46 @@ GLFWAPI int glfwGetGamepadState(int jid, GLFWgamepadstate* state)
     if (!js->connected)
         return GLFW_FALSE;
 
-    if (!_glfw.platform.pollJoystick(js, _GLFW_POLL_ALL))
+    if (!pollJoystick(js, _GLFW_POLL_ALL))
         return GLFW_FALSE;
 
     if (!js->mapping)
         return GLFW_FALSE;
 
-    for (i = 0;  i <= GLFW_GAMEPAD_BUTTON_LAST;  i++)
-    {
-        const _GLFWmapelement* e = js->mapping->buttons + i;
-        if (e->type == _GLFW_JOYSTICK_AXIS)
-        {
-            const float value = js->axes[e->index] * e->axisScale + e->axisOffset;
-            // HACK: This should be baked into the value transform
-            // TODO: Bake into transform when implementing output modifiers
-            if (e->axisOffset < 0 || (e->axisOffset == 0 && e->axisScale > 0))
-            {
-                if (value >= 0.f)
-                    state->buttons[i] = GLFW_PRESS;
-            }
-            else
-            {
-                if (value <= 0.f)
-                    state->buttons[i] = GLFW_PRESS;
-            }
-        }
-        else if (e->type == _GLFW_JOYSTICK_HATBIT)
-        {
-            const unsigned int hat = e->index >> 4;
-            const unsigned int bit = e->index & 0xf;
-            if (js->hats[hat] & bit)
-                state->buttons[i] = GLFW_PRESS;
-        }
-        else if (e->type == _GLFW_JOYSTICK_BUTTON)
-            state->buttons[i] = js->buttons[e->index];
-    }
+    evaluateGamepadTransform(js, state);
+    return GLFW_TRUE;
+}
 
-    for (i = 0;  i <= GLFW_GAMEPAD_AXIS_LAST;  i++)
+GLFWAPI int glfwGetAllGamepadStates(GLFWgamepadstate* states,
+                                    unsigned int* connectedMask)
+{
+    int jid;
+
+    assert(states != NULL);
+    assert(connectedMask != NULL);
+
+    memset(states, 0, sizeof(GLFWgamepadstate) * (GLFW_JOYSTICK_LAST + 1));
+    *connectedMask = 0;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    if (!initJoysticks())
+        return GLFW_FALSE;
+
+    for (jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
     {
-        const _GLFWmapelement* e = js->mapping->axes + i;
-        if (e->type == _GLFW_JOYSTICK_AXIS)
-        {
-            const float value = js->axes[e->index] * e->axisScale + e->axisOffset;
-            state->axes[i] = _glfw_fminf(_glfw_fmaxf(value, -1.f), 1.f);
-        }
-        else if (e->type == _GLFW_JOYSTICK_HATBIT)
-        {
-            const unsigned int hat = e->index >> 4;
-            const unsigned int bit = e->index & 0xf;
-            if (js->hats[hat] & bit)
-                state->axes[i] = 1.f;
-            else
-                state->axes[i] = -1.f;
-        }
-        else if (e->type == _GLFW_JOYSTICK_BUTTON)
-            state->axes[i] = js->buttons[e->index] * 2.f - 1.f;
+        _GLFWjoystick* js = _glfw.joysticks + jid;
+        if (!js->connected || !js->mapping)
+            continue;
+
+        if (!pollJoystick(js, _GLFW_POLL_ALL))
+            continue;
+
+        evaluateGamepadTransform(js, states + jid);
+        *connectedMask |= 1u << jid;
     }
 
-    return GLFW_TRUE;
+    return *connectedMask != 0;
 }
 
 GLFWAPI void glfwSetClipboardString(GLFWwindow* handle, const char* string)
@@ -1498,3 +2396,14 @@ GLFWAPI uint64_t glfwGetTimerFrequency(void)
     return _glfwPlatformGetTimerFrequency();
 }
 
+GLFWAPI double glfwGetEventTime(void)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(0.0);
+
+    if (!_glfw.eventTime.current)
+        return 0.0;
+
+    return (double) (_glfw.eventTime.current - _glfw.timer.offset) /
+        _glfwPlatformGetTimerFrequency();
+}
+
@@ -74,9 +74,11 @@ typedef struct _GLFWmonitor     _GLFWmonitor;
 typedef struct _GLFWcursor      _GLFWcursor;
 typedef struct _GLFWmapelement  _GLFWmapelement;
 typedef struct _GLFWmapping     _GLFWmapping;
+typedef struct _GLFWgamepadtransform _GLFWgamepadtransform;
 typedef struct _GLFWjoystick    _GLFWjoystick;
 typedef struct _GLFWtls         _GLFWtls;
 typedef struct _GLFWmutex       _GLFWmutex;
+typedef struct _GLFWuserevent   _GLFWuserevent;
 
 #define GL_VERSION 0x1f02
 #define GL_NONE 0
@@ -369,6 +371,9 @@ struct _GLFWerror
 struct _GLFWinitconfig
 {
     GLFWbool      hatButtons;
+    GLFWbool      joystickSampling;
+    GLFWbool      eventQueue;
+    GLFWbool      imageCache;
     int           angleType;
     int           platformID;
     PFN_vkGetInstanceProcAddr vulkanLoader;
@@ -548,6 +553,15 @@ struct _GLFWwindow
     // Virtual cursor position when cursor is disabled
     double              virtualCursorPosX, virtualCursorPosY;
     GLFWbool            rawMouseMotion;
+    GLFWbool            cursorCoalescing;
+    // Coalesced cursor position not yet reported to the application
+    GLFWbool            cursorPending;
+    uint64_t            cursorPendingTime;
+    // Cursor positions and scroll offsets received during the current event
+    // processing call
+    GLFWcursorsample*   cursorSamples;
+    int                 cursorSampleCount;
+    int                 cursorSampleCapacity;
 
     _GLFWcontext        context;
 
@@ -563,6 +577,7 @@ struct _GLFWwindow
         GLFWwindowcontentscalefun scale;
         GLFWmousebuttonfun        mouseButton;
         GLFWcursorposfun          cursorPos;
+        GLFWcursorhistoryfun      cursorHistory;
         GLFWcursorenterfun        cursorEnter;
         GLFWscrollfun             scroll;
         GLFWkeyfun                key;
@@ -604,6 +619,12 @@ struct _GLFWmonitor
 struct _GLFWcursor
 {
     _GLFWcursor*    next;
+    // Number of extra handles returned by the custom cursor cache
+    int             references;
+    // Key and copy of the source image, if the cursor is in the cache
+    uint64_t        hash;
+    GLFWimage       image;
+    int             xhot, yhot;
     // This is defined in platform.h
     GLFW_PLATFORM_CURSOR_STATE
 };
@@ -620,6 +641,8 @@ struct _GLFWmapelement
 
 // Gamepad mapping structure
 //
+// The built-in mapping table in mapping_table.h is generated with this layout
+//
 struct _GLFWmapping
 {
     char            name[128];
@@ -628,6 +651,32 @@ struct _GLFWmapping
     _GLFWmapelement axes[6];
 };
 
+#define _GLFW_GAMEPAD_ELEMENT_COUNT \
+    (GLFW_GAMEPAD_BUTTON_LAST + 1 + GLFW_GAMEPAD_AXIS_LAST + 1)
+
+// Gamepad mapping compiled for a specific joystick
+//
+// Gamepad buttons are elements 0 to GLFW_GAMEPAD_BUTTON_LAST and the gamepad
+// axes follow them.  The input of each element is gathered from the joystick
+// and transformed to input * scale + offset, which is clamped for axes and
+// compared against zero for buttons.  Unmapped elements have no gather
+//
+struct _GLFWgamepadtransform
+{
+    // Gathers are ordered by source type; axes, then buttons, then hat bits
+    int             axisGatherEnd;
+    int             buttonGatherEnd;
+    int             gatherCount;
+    struct
+    {
+        uint8_t     source;
+        uint8_t     target;
+        uint8_t     mask;
+    } gathers[_GLFW_GAMEPAD_ELEMENT_COUNT];
+    float           scales[_GLFW_GAMEPAD_ELEMENT_COUNT];
+    float           offsets[_GLFW_GAMEPAD_ELEMENT_COUNT];
+};
+
 // Joystick structure
 //
 struct _GLFWjoystick
@@ -636,6 +685,10 @@ struct _GLFWjoystick
     GLFWbool        connected;
     float*          axes;
     int             axisCount;
+    // Deadzone reported by the device for each axis, or zero
+    float*          deviceDeadzones;
+    float           deadzone;
+    float           fuzz;
     unsigned char*  buttons;
     int             buttonCount;
     unsigned char*  hats;
@@ -643,7 +696,14 @@ struct _GLFWjoystick
     char            name[128];
     void*           userPointer;
     char            guid[33];
-    _GLFWmapping*   mapping;
+    const _GLFWmapping* mapping;
+    _GLFWgamepadtransform gamepad;
+    // Ring buffer of recorded samples, if joystick sampling is enabled
+    GLFWjoysticksample* samples;
+    int             sampleFirst;
+    int             sampleCount;
+    // Whether the state is being updated, with its callbacks being called
+    GLFWbool        polling;
 
     // This is defined in platform.h
     GLFW_PLATFORM_JOYSTICK_STATE
@@ -665,6 +725,14 @@ struct _GLFWmutex
     GLFW_PLATFORM_MUTEX_STATE
 };
 
+// User event structure
+//
+struct _GLFWuserevent
+{
+    _GLFWuserevent* next;
+    void*           payload;
+};
+
 // Platform API structure
 //
 struct _GLFWplatform
@@ -680,6 +748,7 @@ struct _GLFWplatform
     void (*setRawMouseMotion)(_GLFWwindow*,GLFWbool);
     GLFWbool (*rawMouseMotionSupported)(void);
     GLFWbool (*createCursor)(_GLFWcursor*,const GLFWimage*,int,int);
+    GLFWbool (*createAnimatedCursor)(_GLFWcursor*,const GLFWimage*,int,const double*,int,int);
     GLFWbool (*createStandardCursor)(_GLFWcursor*,int);
     void (*destroyCursor)(_GLFWcursor*);
     void (*setCursor)(_GLFWwindow*,_GLFWcursor*);
@@ -738,6 +807,7 @@ struct _GLFWplatform
     void (*pollEvents)(void);
     void (*waitEvents)(void);
     void (*waitEventsTimeout)(double);
+    void (*waitEventsUntil)(uint64_t);
     void (*postEmptyEvent)(void);
     // EGL
     EGLenum (*getEGLPlatform)(EGLint**);
@@ -777,10 +847,63 @@ struct _GLFWlibrary
     _GLFWjoystick       joysticks[GLFW_JOYSTICK_LAST + 1];
     _GLFWmapping*       mappings;
     int                 mappingCount;
+    int                 mappingCapacity;
+    // Open addressing hash index of mappings by GUID, holding index + 1
+    int*                mappingIndex;
+    int                 mappingIndexSize;
+
+    struct {
+        // Timer value of the native event being processed, or zero if unknown
+        uint64_t        source;
+        // Timer value of the input event most recently reported
+        uint64_t        current;
+        // Estimated offset from native millisecond timestamps to timer
+        // milliseconds, and the last native timestamp extended to 64 bits
+        GLFWbool        estimated;
+        int64_t         offset;
+        int64_t         last;
+    } eventTime;
+
+    // Double-buffered input event queue, where one buffer is being recorded
+    // into while the other may be read by the application
+    struct {
+        GLFWevent*      events[2];
+        int             capacity[2];
+        int             current;
+        int             count;
+        // Number of events in the buffer last returned to the application
+        int             returnedCount;
+    } eventQueue;
+
+    // Lock-free stack of posted user events, most recent first, that any
+    // thread may push to and the main thread takes in its entirety
+    struct {
+        void* volatile  head;
+    } userEvents;
+
+    struct {
+        // Target frame period and busy-wait tail, in timer units
+        uint64_t        period;
+        uint64_t        spin;
+        // Timer value when the next frame should start, or zero before the
+        // first frame
+        uint64_t        deadline;
+        // Timer value when the previous frame started
+        uint64_t        start;
+        // Statistics since the last call to glfwGetFrameStats
+        int             frameCount;
+        int             missedCount;
+        uint64_t        totalTime;
+        uint64_t        minimumTime;
+        uint64_t        maximumTime;
+        uint64_t        maximumLateness;
+    } pacer;
 
     _GLFWtls            errorSlot;
     _GLFWtls            contextSlot;
     _GLFWmutex          errorLock;
+    // Guards the joystick slots against the joystick sampling thread, if any
+    _GLFWmutex          joystickLock;
 
     struct {
         uint64_t        offset;
@@ -863,12 +986,17 @@ struct _GLFWlibrary
     struct {
         GLFWmonitorfun  monitor;
         GLFWjoystickfun joystick;
+        GLFWjoystickaxisfun joystickAxis;
+        GLFWjoystickbuttonfun joystickButton;
+        GLFWjoystickhatfun joystickHat;
+        GLFWusereventfun userEvent;
     } callbacks;
 
     // These are defined in platform.h
     GLFW_PLATFORM_LIBRARY_WINDOW_STATE
     GLFW_PLATFORM_LIBRARY_CONTEXT_STATE
     GLFW_PLATFORM_LIBRARY_JOYSTICK_STATE
+    GLFW_PLATFORM_LIBRARY_POLL_STATE
 };
 
 // Global state shared between compilation units of GLFW
@@ -894,10 +1022,18 @@ void _glfwPlatformDestroyMutex(_GLFWmutex* mutex);
 void _glfwPlatformLockMutex(_GLFWmutex* mutex);
 void _glfwPlatformUnlockMutex(_GLFWmutex* mutex);
 
+void* _glfwPlatformExchangePointer(void* volatile* target, void* value);
+void* _glfwPlatformCompareExchangePointer(void* volatile* target,
+                                          void* expected,
+                                          void* desired);
+
 void* _glfwPlatformLoadModule(const char* path);
 void _glfwPlatformFreeModule(void* module);
 GLFWproc _glfwPlatformGetModuleSymbol(void* module, const char* name);
 
+GLFWbool _glfwPlatformMapFile(const char* path, void** data, size_t* size);
+void _glfwPlatformUnmapFile(void* data, size_t size);
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
@@ -928,6 +1064,9 @@ void _glfwInputJoystick(_GLFWjoystick* js, int event);
 void _glfwInputJoystickAxis(_GLFWjoystick* js, int axis, float value);
 void _glfwInputJoystickButton(_GLFWjoystick* js, int button, char value);
 void _glfwInputJoystickHat(_GLFWjoystick* js, int hat, char value);
+void _glfwInputJoystickSample(_GLFWjoystick* js,
+                              int type, int index, float value, double time);
+void _glfwInputEventTime(uint64_t value);
 
 void _glfwInputMonitor(_GLFWmonitor* monitor, int action, int placement);
 void _glfwInputMonitorWindow(_GLFWmonitor* monitor, _GLFWwindow* window);
@@ -963,7 +1102,6 @@ void _glfwAllocGammaArrays(GLFWgammaramp* ramp, unsigned int size);
 void _glfwFreeGammaArrays(GLFWgammaramp* ramp);
 void _glfwSplitBPP(int bpp, int* red, int* green, int* blue);
 
-void _glfwInitGamepadMappings(void);
 _GLFWjoystick* _glfwAllocJoystick(const char* name,
                                   const char* guid,
                                   int axisCount,
@@ -971,6 +1109,8 @@ _GLFWjoystick* _glfwAllocJoystick(const char* name,
                                   int hatCount);
 void _glfwFreeJoystick(_GLFWjoystick* js);
 void _glfwCenterCursorInContentArea(_GLFWwindow* window);
+void _glfwFlushPendingInput(void);
+uint64_t _glfwMillisecondsToTimerValue(uint32_t milliseconds);
 
 GLFWbool _glfwInitEGL(void);
 void _glfwTerminateEGL(void);
@@ -996,6 +1136,7 @@ const char* _glfwGetVulkanResultString(VkResult result);
 
 size_t _glfwEncodeUTF8(char* s, uint32_t codepoint);
 char** _glfwParseUriList(char* text, int* count);
+uint64_t _glfwHashImage(const GLFWimage* image, uint64_t hash);
 
 char* _glfw_strdup(const char* source);
 int _glfw_min(int a, int b);
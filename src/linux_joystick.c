@@ -34,6 +34,8 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/inotify.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <fcntl.h>
 #include <errno.h>
 #include <dirent.h>
@@ -41,19 +43,75 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <math.h>
 
 #ifndef SYN_DROPPED // < v2.6.39 kernel headers
 // Workaround for CentOS-6, which is supported till 2020-11-30, but still on v2.6.32
 #define SYN_DROPPED 3
 #endif
 
+#ifndef input_event_sec // < v4.16 kernel headers
+#define input_event_sec time.tv_sec
+#define input_event_usec time.tv_usec
+#endif
+
+// Devices drained less than a period of this rate ago are considered up to date
+// by the joystick functions, so that calling several of them after event
+// processing makes no system calls
+#define _GLFW_LINUX_DRAIN_RATE 100
+
+// Converts a timer value to seconds since the GLFW time base
+//
+static double timerValueToTime(uint64_t value)
+{
+    return (double) (value - _glfw.timer.offset) /
+        _glfwPlatformGetTimerFrequency();
+}
+
+// Locks the joystick slots against the sampling thread, if it is running
+//
+static void lockJoysticks(void)
+{
+    if (_glfw.linjs.sampling)
+        _glfwPlatformLockMutex(&_glfw.joystickLock);
+}
+
+// Unlocks the joystick slots, if the sampling thread is running
+//
+static void unlockJoysticks(void)
+{
+    if (_glfw.linjs.sampling)
+        _glfwPlatformUnlockMutex(&_glfw.joystickLock);
+}
+
+// Returns the epoll set that joystick devices are added to
+//
+static int getDeviceEpoll(void)
+{
+    if (_glfw.linjs.sampling)
+        return _glfw.linjs.samplingEpoll;
+    else
+        return _glfw.linjs.epoll;
+}
+
 // Apply an EV_KEY event to the specified joystick
 //
 static void handleKeyEvent(_GLFWjoystick* js, int code, int value)
 {
-    _glfwInputJoystickButton(js,
-                             js->linjs.keyMap[code - BTN_MISC],
-                             value ? GLFW_PRESS : GLFW_RELEASE);
+    if (code < BTN_MISC || code >= KEY_CNT)
+        return;
+
+    const int index = js->linjs.keyMap[code - BTN_MISC];
+    if (index < 0)
+        return;
+
+    const char state = value ? GLFW_PRESS : GLFW_RELEASE;
+    if (js->buttons[index] == state)
+        return;
+
+    _glfwInputJoystickButton(js, index, state);
+    _glfwInputJoystickSample(js, GLFW_JOYSTICK_SAMPLE_BUTTON,
+                             index, state, js->linjs.time);
 }
 
 // Apply an EV_ABS event to the specified joystick
@@ -84,45 +142,134 @@ static void handleAbsEvent(_GLFWjoystick* js, int code, int value)
         else if (value > 0)
             state[axis] = 2;
 
-        _glfwInputJoystickHat(js, index, stateMap[state[0]][state[1]]);
+        const char hatState = stateMap[state[0]][state[1]];
+        if (js->hats[index] == hatState)
+            return;
+
+        _glfwInputJoystickHat(js, index, hatState);
+        _glfwInputJoystickSample(js, GLFW_JOYSTICK_SAMPLE_HAT,
+                                 index, hatState, js->linjs.time);
     }
     else
     {
-        const struct input_absinfo* info = &js->linjs.absInfo[code];
-        float normalized = value;
+        const float normalized =
+            value * js->linjs.absScale[code] + js->linjs.absBias[code];
+        const float previous = js->axes[index];
 
-        const int range = info->maximum - info->minimum;
-        if (range)
+        _glfwInputJoystickAxis(js, index, normalized);
+
+        // Changes dropped by the deadzone or fuzz filter are not samples
+        if (js->axes[index] != previous)
         {
-            // Normalize to 0.0 -> 1.0
-            normalized = (normalized - info->minimum) / range;
-            // Normalize to -1.0 -> 1.0
-            normalized = normalized * 2.0f - 1.0f;
+            _glfwInputJoystickSample(js, GLFW_JOYSTICK_SAMPLE_AXIS,
+                                     index, js->axes[index], js->linjs.time);
         }
+    }
+}
 
-        _glfwInputJoystickAxis(js, index, normalized);
+// Precomputes the coefficients that map the range of an axis to -1.0 -> 1.0
+//
+static void updateAbsCoefficients(_GLFWjoystickLinux* linjs, int code)
+{
+    const struct input_absinfo* info = &linjs->absInfo[code];
+    const int range = info->maximum - info->minimum;
+
+    if (range)
+    {
+        linjs->absScale[code] = 2.f / range;
+        linjs->absBias[code] = -1.f - info->minimum * linjs->absScale[code];
+    }
+    else
+    {
+        linjs->absScale[code] = 1.f;
+        linjs->absBias[code] = 0.f;
     }
 }
 
-// Poll state of absolute axes
+// Derives the device deadzone of an axis from its flat range
+// This must be called after the coefficients of the axis have been updated
 //
-static void pollAbsState(_GLFWjoystick* js)
+static void updateDeviceDeadzone(_GLFWjoystick* js, int code)
 {
+    const int index = js->linjs.absMap[code];
+    if (index < 0 || (code >= ABS_HAT0X && code <= ABS_HAT3Y))
+        return;
+
+    js->deviceDeadzones[index] =
+        fabsf(js->linjs.absInfo[code].flat * js->linjs.absScale[code]);
+}
+
+// Apply the absolute axis values that have changed since the last report
+//
+static void flushAbsChanges(_GLFWjoystick* js)
+{
+    for (int i = 0;  i < (int) sizeof(js->linjs.absChanged);  i++)
+    {
+        if (!js->linjs.absChanged[i])
+            continue;
+
+        for (int code = i * 8;  code < i * 8 + 8 && code < ABS_CNT;  code++)
+        {
+            if (!(js->linjs.absChanged[i] & (1 << (code % 8))))
+                continue;
+            if (js->linjs.absMap[code] < 0)
+                continue;
+
+            handleAbsEvent(js, code, js->linjs.absInfo[code].value);
+        }
+
+        js->linjs.absChanged[i] = 0;
+    }
+}
+
+#define isBitSet(bit, arr) (arr[(bit) / 8] & (1 << ((bit) % 8)))
+
+// Queries the current state of every mapped button and axis and reports the
+// ones that differ from the last reported state
+//
+static void resyncJoystick(_GLFWjoystick* js)
+{
+    char keyBits[(KEY_CNT + 7) / 8] = {0};
+
+    if (ioctl(js->linjs.fd, EVIOCGKEY(sizeof(keyBits)), keyBits) >= 0)
+    {
+        for (int code = BTN_MISC;  code < KEY_CNT;  code++)
+        {
+            const int index = js->linjs.keyMap[code - BTN_MISC];
+            if (index < 0)
+                continue;
+
+            const char state = isBitSet(code, keyBits) ? GLFW_PRESS : GLFW_RELEASE;
+            if (js->buttons[index] != state)
+                handleKeyEvent(js, code, state == GLFW_PRESS);
+        }
+    }
+
     for (int code = 0;  code < ABS_CNT;  code++)
     {
         if (js->linjs.absMap[code] < 0)
             continue;
 
-        struct input_absinfo* info = &js->linjs.absInfo[code];
+        struct input_absinfo info;
 
-        if (ioctl(js->linjs.fd, EVIOCGABS(code), info) < 0)
+        if (ioctl(js->linjs.fd, EVIOCGABS(code), &info) < 0)
             continue;
 
-        handleAbsEvent(js, code, info->value);
+        // Axes with a value that was received but not yet reported count as
+        // changed even if the value is the same
+        const GLFWbool changed = info.value != js->linjs.absInfo[code].value ||
+                                 isBitSet(code, js->linjs.absChanged);
+
+        js->linjs.absInfo[code] = info;
+        updateAbsCoefficients(&js->linjs, code);
+        updateDeviceDeadzone(js, code);
+
+        if (changed)
+            handleAbsEvent(js, code, info.value);
     }
-}
 
-#define isBitSet(bit, arr) (arr[(bit) / 8] & (1 << ((bit) % 8)))
+    memset(js->linjs.absChanged, 0, sizeof(js->linjs.absChanged));
+}
 
 // Attempt to open the specified joystick device
 //
@@ -194,6 +341,7 @@ static GLFWbool openJoystickDevice(const char* path)
 
     for (int code = BTN_MISC;  code < KEY_CNT;  code++)
     {
+        linjs.keyMap[code - BTN_MISC] = -1;
         if (!isBitSet(code, keyBits))
             continue;
 
@@ -210,6 +358,7 @@ static GLFWbool openJoystickDevice(const char* path)
         if (code >= ABS_HAT0X && code <= ABS_HAT3Y)
         {
             linjs.absMap[code] = hatCount;
+            linjs.absMap[code + 1] = hatCount;
             hatCount++;
             // Skip the Y axis
             code++;
@@ -219,15 +368,34 @@ static GLFWbool openJoystickDevice(const char* path)
             if (ioctl(linjs.fd, EVIOCGABS(code), &linjs.absInfo[code]) < 0)
                 continue;
 
+            updateAbsCoefficients(&linjs, code);
+
             linjs.absMap[code] = axisCount;
             axisCount++;
         }
     }
 
+#if defined(EVIOCSCLOCKID)
+    // Have event timestamps use the same clock as the GLFW timer
+    int clock = _glfw.timer.posix.clock;
+    if (ioctl(linjs.fd, EVIOCSCLOCKID, &clock) == 0)
+        linjs.eventClock = GLFW_TRUE;
+#endif
+
+    if (_glfw.linjs.sampling)
+    {
+        linjs.ring = _glfw_calloc(_GLFW_LINUX_SAMPLE_RING_SIZE,
+                                  sizeof(_GLFWsampleLinux));
+    }
+
+    lockJoysticks();
+
     _GLFWjoystick* js =
         _glfwAllocJoystick(name, guid, axisCount, buttonCount, hatCount);
     if (!js)
     {
+        unlockJoysticks();
+        _glfw_free(linjs.ring);
         close(linjs.fd);
         return GLFW_FALSE;
     }
@@ -235,7 +403,19 @@ static GLFWbool openJoystickDevice(const char* path)
     strncpy(linjs.path, path, sizeof(linjs.path) - 1);
     memcpy(&js->linjs, &linjs, sizeof(linjs));
 
-    pollAbsState(js);
+    struct epoll_event event = { .events = EPOLLIN, .data.fd = linjs.fd };
+    epoll_ctl(getDeviceEpoll(), EPOLL_CTL_ADD, linjs.fd, &event);
+
+    unlockJoysticks();
+
+    // The flat range of each axis is used if the device deadzone is selected
+    for (int code = 0;  code < ABS_CNT;  code++)
+        updateDeviceDeadzone(js, code);
+
+    // Report the initial state of every axis and of any buttons already held
+    js->linjs.time = timerValueToTime(_glfwPlatformGetTimerValue());
+    memset(js->linjs.absChanged, 0xff, sizeof(js->linjs.absChanged));
+    resyncJoystick(js);
 
     _glfwInputJoystick(js, GLFW_CONNECTED);
     return GLFW_TRUE;
@@ -248,8 +428,13 @@ static GLFWbool openJoystickDevice(const char* path)
 static void closeJoystick(_GLFWjoystick* js)
 {
     _glfwInputJoystick(js, GLFW_DISCONNECTED);
+
+    lockJoysticks();
+    epoll_ctl(getDeviceEpoll(), EPOLL_CTL_DEL, js->linjs.fd, NULL);
     close(js->linjs.fd);
+    _glfw_free(js->linjs.ring);
     _glfwFreeJoystick(js);
+    unlockJoysticks();
 }
 
 // Lexically compare joysticks by name; used by qsort
@@ -262,11 +447,9 @@ static int compareJoysticks(const void* fp, const void* sp)
 }
 
 
-//////////////////////////////////////////////////////////////////////////
-//////                       GLFW internal API                      //////
-//////////////////////////////////////////////////////////////////////////
-
-void _glfwDetectJoystickConnectionLinux(void)
+// Opens and closes joysticks as device nodes are created and deleted
+//
+static void detectJoystickConnection(void)
 {
     if (_glfw.linjs.inotify <= 0)
         return;
@@ -304,6 +487,338 @@ void _glfwDetectJoystickConnectionLinux(void)
     }
 }
 
+// Applies a single evdev event to the specified joystick
+//
+static void processEvent(_GLFWjoystick* js, int type, int code, int value)
+{
+    if (type == EV_SYN)
+    {
+        if (code == SYN_DROPPED)
+            js->linjs.dropped = GLFW_TRUE;
+        else if (code == SYN_REPORT)
+        {
+            if (js->linjs.dropped)
+            {
+                // Events were lost so query the current state of the device and
+                // report what changed since the last report
+                js->linjs.dropped = GLFW_FALSE;
+                resyncJoystick(js);
+            }
+            else
+                flushAbsChanges(js);
+        }
+    }
+
+    // Events between SYN_DROPPED and the next SYN_REPORT are incomplete
+    if (js->linjs.dropped)
+        return;
+
+    if (type == EV_KEY)
+        handleKeyEvent(js, code, value);
+    else if (type == EV_ABS && code < ABS_CNT)
+    {
+        // Axis events are applied when the report is complete, using the last
+        // value of each axis that changed during the report
+        js->linjs.absInfo[code].value = value;
+        js->linjs.absChanged[code / 8] |= 1 << (code % 8);
+    }
+}
+
+// Reads and applies all queued events of the specified joystick
+//
+static void pollJoystickEvents(_GLFWjoystick* js)
+{
+    struct input_event events[64];
+    const size_t capacity = sizeof(events) / sizeof(events[0]);
+
+    for (;;)
+    {
+        const ssize_t size = read(js->linjs.fd, events, sizeof(events));
+        if (size < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            // Reset the joystick slot if the device was disconnected
+            if (errno == ENODEV)
+                closeJoystick(js);
+
+            break;
+        }
+
+        const size_t count = size / sizeof(events[0]);
+
+        for (size_t i = 0;  i < count;  i++)
+        {
+            if (js->linjs.eventClock)
+            {
+                _glfwInputEventTime((uint64_t) events[i].input_event_sec * 1000000000 +
+                                    (uint64_t) events[i].input_event_usec * 1000);
+            }
+
+            processEvent(js, events[i].type, events[i].code, events[i].value);
+        }
+
+        _glfwInputEventTime(0);
+
+        // A short read means the queue of the device has been emptied
+        if (count < capacity)
+            break;
+    }
+}
+
+// Applies the events buffered by the sampling thread for the specified joystick
+// This is only called from the main thread
+//
+static void consumeSamples(_GLFWjoystick* js)
+{
+    const unsigned int head = __atomic_load_n(&js->linjs.ringHead, __ATOMIC_ACQUIRE);
+    unsigned int tail = js->linjs.ringTail;
+
+    while (tail != head)
+    {
+        const _GLFWsampleLinux* sample =
+            js->linjs.ring + (tail & (_GLFW_LINUX_SAMPLE_RING_SIZE - 1));
+
+        js->linjs.time = timerValueToTime(sample->time);
+        _glfwInputEventTime(sample->time);
+        processEvent(js, sample->type, sample->code, sample->value);
+        tail++;
+    }
+
+    _glfwInputEventTime(0);
+
+    __atomic_store_n(&js->linjs.ringTail, tail, __ATOMIC_RELEASE);
+
+    if (__atomic_exchange_n(&js->linjs.ringOverflow, GLFW_FALSE, __ATOMIC_ACQ_REL))
+    {
+        // The ring was full and events were discarded
+        js->linjs.time = timerValueToTime(_glfwPlatformGetTimerValue());
+        resyncJoystick(js);
+    }
+
+    // Reset the joystick slot if the device was disconnected
+    if (__atomic_load_n(&js->linjs.lost, __ATOMIC_ACQUIRE))
+        closeJoystick(js);
+}
+
+// Reads all queued events of the specified joystick into its ring
+// This is only called from the sampling thread, with the joysticks locked
+//
+static void sampleJoystick(_GLFWjoystick* js)
+{
+    struct input_event events[64];
+    const size_t capacity = sizeof(events) / sizeof(events[0]);
+
+    for (;;)
+    {
+        const ssize_t size = read(js->linjs.fd, events, sizeof(events));
+        if (size < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            // Leave closing the device to the main thread
+            if (errno == ENODEV)
+            {
+                epoll_ctl(_glfw.linjs.samplingEpoll, EPOLL_CTL_DEL, js->linjs.fd, NULL);
+                __atomic_store_n(&js->linjs.lost, GLFW_TRUE, __ATOMIC_RELEASE);
+            }
+
+            break;
+        }
+
+        const uint64_t now = _glfwPlatformGetTimerValue();
+        const size_t count = size / sizeof(events[0]);
+        unsigned int head = js->linjs.ringHead;
+
+        for (size_t i = 0;  i < count;  i++)
+        {
+            const unsigned int tail =
+                __atomic_load_n(&js->linjs.ringTail, __ATOMIC_ACQUIRE);
+
+            if (head - tail == _GLFW_LINUX_SAMPLE_RING_SIZE)
+            {
+                __atomic_store_n(&js->linjs.ringOverflow, GLFW_TRUE, __ATOMIC_RELEASE);
+                continue;
+            }
+
+            _GLFWsampleLinux* sample =
+                js->linjs.ring + (head & (_GLFW_LINUX_SAMPLE_RING_SIZE - 1));
+
+            if (js->linjs.eventClock)
+            {
+                sample->time = (uint64_t) events[i].input_event_sec * 1000000000 +
+                               (uint64_t) events[i].input_event_usec * 1000;
+            }
+            else
+                sample->time = now;
+
+            sample->type = events[i].type;
+            sample->code = events[i].code;
+            sample->value = events[i].value;
+            head++;
+        }
+
+        __atomic_store_n(&js->linjs.ringHead, head, __ATOMIC_RELEASE);
+
+        // A short read means the queue of the device has been emptied
+        if (count < capacity)
+            break;
+    }
+}
+
+// Entry point of the joystick sampling thread
+//
+static void* samplingThreadMain(void* arg)
+{
+    for (;;)
+    {
+        struct epoll_event events[GLFW_JOYSTICK_LAST + 2];
+        const int count = epoll_wait(_glfw.linjs.samplingEpoll, events,
+                                     sizeof(events) / sizeof(events[0]), -1);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        _glfwPlatformLockMutex(&_glfw.joystickLock);
+
+        for (int i = 0;  i < count;  i++)
+        {
+            const int fd = events[i].data.fd;
+
+            if (fd == _glfw.linjs.samplingStop)
+            {
+                _glfwPlatformUnlockMutex(&_glfw.joystickLock);
+                return NULL;
+            }
+
+            for (int jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+            {
+                _GLFWjoystick* js = _glfw.joysticks + jid;
+                if (js->allocated && js->linjs.fd == fd)
+                {
+                    sampleJoystick(js);
+                    break;
+                }
+            }
+        }
+
+        _glfwPlatformUnlockMutex(&_glfw.joystickLock);
+    }
+
+    return NULL;
+}
+
+
+// Reads the devices that have pending events, as reported by the epoll set,
+// and optionally detects device connections
+//
+static void drainJoysticks(GLFWbool detect)
+{
+    struct epoll_event events[GLFW_JOYSTICK_LAST + 2];
+    const int count = epoll_wait(_glfw.linjs.epoll, events,
+                                 sizeof(events) / sizeof(events[0]), 0);
+
+    for (int i = 0;  i < count;  i++)
+    {
+        const int fd = events[i].data.fd;
+
+        if (fd == _glfw.linjs.inotify)
+        {
+            if (detect)
+                detectJoystickConnection();
+
+            continue;
+        }
+
+        for (int jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+        {
+            _GLFWjoystick* js = _glfw.joysticks + jid;
+            if (js->connected && js->linjs.fd == fd)
+            {
+                // Make joystick functions called from callbacks return the
+                // state applied so far, as the getters do for their own reads
+                const GLFWbool polling = js->polling;
+                js->polling = GLFW_TRUE;
+                pollJoystickEvents(js);
+
+                // The slot is cleared if the device was disconnected
+                if (js->allocated)
+                    js->polling = polling;
+
+                break;
+            }
+        }
+    }
+
+    _glfw.linjs.drainTime = _glfwPlatformGetTimerValue();
+}
+
+// Closes the descriptors created before setting up joystick sampling failed
+//
+static void closeSamplingDescriptors(void)
+{
+    if (_glfw.linjs.samplingEpoll > 0)
+        close(_glfw.linjs.samplingEpoll);
+    if (_glfw.linjs.samplingStop > 0)
+        close(_glfw.linjs.samplingStop);
+    if (_glfw.linjs.epoll > 0)
+        close(_glfw.linjs.epoll);
+
+    _glfw.linjs.samplingEpoll = -1;
+    _glfw.linjs.samplingStop = -1;
+    _glfw.linjs.epoll = -1;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Returns the descriptor that event waits should include for joysticks
+// Joystick input only wakes a wait if a callback would report it, otherwise
+// only device connections do
+//
+int _glfwGetJoystickWaitFdLinux(void)
+{
+    if (_glfw.callbacks.joystickAxis ||
+        _glfw.callbacks.joystickButton ||
+        _glfw.callbacks.joystickHat)
+    {
+        return _glfw.linjs.epoll;
+    }
+    else
+        return _glfw.linjs.inotify;
+}
+
+// Drains the devices that have pending events and detects device connections
+// This is called during event processing so that joystick input is reported
+// as it arrives
+//
+void _glfwPollJoystickEventsLinux(void)
+{
+    if (_glfw.linjs.sampling)
+    {
+        for (int jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+        {
+            _GLFWjoystick* js = _glfw.joysticks + jid;
+            if (js->connected)
+            {
+                js->polling = GLFW_TRUE;
+                consumeSamples(js);
+                js->polling = GLFW_FALSE;
+            }
+        }
+    }
+
+    drainJoysticks(GLFW_TRUE);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -313,6 +828,50 @@ GLFWbool _glfwInitJoysticksLinux(void)
 {
     const char* dirname = "/dev/input";
 
+    _glfw.linjs.epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (_glfw.linjs.epoll == -1)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Linux: Failed to create epoll instance: %s",
+                        strerror(errno));
+        return GLFW_FALSE;
+    }
+
+    if (_glfw.hints.init.joystickSampling)
+    {
+        _glfw.linjs.samplingEpoll = epoll_create1(EPOLL_CLOEXEC);
+        _glfw.linjs.samplingStop = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (_glfw.linjs.samplingEpoll == -1 || _glfw.linjs.samplingStop == -1)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Linux: Failed to create joystick sampling fds: %s",
+                            strerror(errno));
+            closeSamplingDescriptors();
+            return GLFW_FALSE;
+        }
+
+        struct epoll_event event = { .events = EPOLLIN, .data.fd = _glfw.linjs.samplingStop };
+        epoll_ctl(_glfw.linjs.samplingEpoll, EPOLL_CTL_ADD, _glfw.linjs.samplingStop, &event);
+
+        if (!_glfwPlatformCreateMutex(&_glfw.joystickLock))
+        {
+            closeSamplingDescriptors();
+            return GLFW_FALSE;
+        }
+
+        if (pthread_create(&_glfw.linjs.samplingThread, NULL,
+                           samplingThreadMain, NULL) != 0)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Linux: Failed to create joystick sampling thread");
+            _glfwPlatformDestroyMutex(&_glfw.joystickLock);
+            closeSamplingDescriptors();
+            return GLFW_FALSE;
+        }
+
+        _glfw.linjs.sampling = GLFW_TRUE;
+    }
+
     _glfw.linjs.inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
     if (_glfw.linjs.inotify > 0)
     {
@@ -322,6 +881,9 @@ GLFWbool _glfwInitJoysticksLinux(void)
         _glfw.linjs.watch = inotify_add_watch(_glfw.linjs.inotify,
                                               dirname,
                                               IN_CREATE | IN_ATTRIB | IN_DELETE);
+
+        struct epoll_event event = { .events = EPOLLIN, .data.fd = _glfw.linjs.inotify };
+        epoll_ctl(_glfw.linjs.epoll, EPOLL_CTL_ADD, _glfw.linjs.inotify, &event);
     }
 
     // Continue without device connection notifications if inotify fails
@@ -359,12 +921,25 @@ GLFWbool _glfwInitJoysticksLinux(void)
 
     // Continue with no joysticks if enumeration fails
 
+    lockJoysticks();
     qsort(_glfw.joysticks, count, sizeof(_GLFWjoystick), compareJoysticks);
+    unlockJoysticks();
     return GLFW_TRUE;
 }
 
 void _glfwTerminateJoysticksLinux(void)
 {
+    if (_glfw.linjs.sampling)
+    {
+        const uint64_t value = 1;
+
+        while (write(_glfw.linjs.samplingStop, &value, sizeof(value)) == -1 &&
+               errno == EINTR)
+            ;
+
+        pthread_join(_glfw.linjs.samplingThread, NULL);
+    }
+
     for (int jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
     {
         _GLFWjoystick* js = _glfw.joysticks + jid;
@@ -380,43 +955,30 @@ void _glfwTerminateJoysticksLinux(void)
         close(_glfw.linjs.inotify);
         regfree(&_glfw.linjs.regex);
     }
+
+    if (_glfw.linjs.epoll > 0)
+        close(_glfw.linjs.epoll);
+
+    _glfwPlatformDestroyMutex(&_glfw.joystickLock);
+
+    if (_glfw.linjs.samplingEpoll > 0)
+        close(_glfw.linjs.samplingEpoll);
+    if (_glfw.linjs.samplingStop > 0)
+        close(_glfw.linjs.samplingStop);
 }
 
 GLFWbool _glfwPollJoystickLinux(_GLFWjoystick* js, int mode)
 {
-    // Read all queued events (non-blocking)
-    for (;;)
+    // Event processing is not required for joystick input to work, so read
+    // the devices on demand unless they were drained only moments ago
+    // NOTE: All devices are drained at once, so that querying every joystick
+    //       in turn makes a single check for pending input
+    if (_glfw.linjs.sampling)
+        consumeSamples(js);
+    else if (_glfwPlatformGetTimerValue() - _glfw.linjs.drainTime >=
+             _glfwPlatformGetTimerFrequency() / _GLFW_LINUX_DRAIN_RATE)
     {
-        struct input_event e;
-
-        errno = 0;
-        if (read(js->linjs.fd, &e, sizeof(e)) < 0)
-        {
-            // Reset the joystick slot if the device was disconnected
-            if (errno == ENODEV)
-                closeJoystick(js);
-
-            break;
-        }
-
-        if (e.type == EV_SYN)
-        {
-            if (e.code == SYN_DROPPED)
-                _glfw.linjs.dropped = GLFW_TRUE;
-            else if (e.code == SYN_REPORT)
-            {
-                _glfw.linjs.dropped = GLFW_FALSE;
-                pollAbsState(js);
-            }
-        }
-
-        if (_glfw.linjs.dropped)
-            continue;
-
-        if (e.type == EV_KEY)
-            handleKeyEvent(js, e.code, e.value);
-        else if (e.type == EV_ABS)
-            handleAbsEvent(js, e.code, e.value);
+        drainJoysticks(GLFW_FALSE);
     }
 
     return js->connected;
@@ -27,10 +27,25 @@
 #include <linux/input.h>
 #include <linux/limits.h>
 #include <regex.h>
+#include <pthread.h>
+#include <stdint.h>
 
 #define GLFW_LINUX_JOYSTICK_STATE         _GLFWjoystickLinux linjs;
 #define GLFW_LINUX_LIBRARY_JOYSTICK_STATE _GLFWlibraryLinux  linjs;
 
+// Number of events buffered per joystick by the sampling thread, a power of two
+#define _GLFW_LINUX_SAMPLE_RING_SIZE 1024
+
+// Timestamped evdev event passed from the sampling thread to the main thread
+//
+typedef struct _GLFWsampleLinux
+{
+    uint64_t                time;
+    uint16_t                type;
+    uint16_t                code;
+    int32_t                 value;
+} _GLFWsampleLinux;
+
 // Linux-specific joystick data
 //
 typedef struct _GLFWjoystickLinux
@@ -40,7 +55,20 @@ typedef struct _GLFWjoystickLinux
     int                     keyMap[KEY_CNT - BTN_MISC];
     int                     absMap[ABS_CNT];
     struct input_absinfo    absInfo[ABS_CNT];
+    float                   absScale[ABS_CNT];
+    float                   absBias[ABS_CNT];
+    unsigned char           absChanged[(ABS_CNT + 7) / 8];
     int                     hats[4][2];
+    GLFWbool                dropped;
+    GLFWbool                eventClock;
+    double                  time;
+    // Lock-free single producer, single consumer ring filled by the sampling
+    // thread and drained by the main thread
+    _GLFWsampleLinux*       ring;
+    unsigned int            ringHead;
+    unsigned int            ringTail;
+    GLFWbool                ringOverflow;
+    GLFWbool                lost;
 } _GLFWjoystickLinux;
 
 // Linux-specific joystick API data
@@ -49,11 +77,18 @@ typedef struct _GLFWlibraryLinux
 {
     int                     inotify;
     int                     watch;
+    int                     epoll;
     regex_t                 regex;
-    GLFWbool                dropped;
+    // Timer value of the last time the devices were drained, or zero
+    uint64_t                drainTime;
+    GLFWbool                sampling;
+    int                     samplingEpoll;
+    int                     samplingStop;
+    pthread_t               samplingThread;
 } _GLFWlibraryLinux;
 
-void _glfwDetectJoystickConnectionLinux(void);
+int _glfwGetJoystickWaitFdLinux(void);
+void _glfwPollJoystickEventsLinux(void);
 
 GLFWbool _glfwInitJoysticksLinux(void);
 void _glfwTerminateJoysticksLinux(void);
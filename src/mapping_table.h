@@ -0,0 +1,987 @@
+//========================================================================
+// GLFW 3.4 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2006-2018 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+// As mapping_table.h.in, this file is used by CMake to produce the
+// mapping_table.h header file.  Gamepad mappings should not be added here but
+// to mappings.h.in.
+//========================================================================
+// As mapping_table.h, this provides all pre-defined gamepad mappings from
+// mappings.h, already parsed and sorted by GUID so that they can be looked up
+// without any parsing or allocation at run-time.  Do not edit this file.
+// This file can be re-generated from mappings.h with the 'update_mappings'
+// CMake target.
+//========================================================================
+
+// All gamepad mappings not labeled GLFW are copied from the
+// SDL_GameControllerDB project under the following license:
+//
+// Simple DirectMedia Layer
+// Copyright (C) 1997-2013 Sam Lantinga <slouken@libsdl.org>
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+const _GLFWmapping _glfwDefaultMappingTable[] =
+{
+#if defined(_GLFW_WIN32)
+{"Saturn_Adapter_2.0","0300000000050000289b000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,5,0,0}}},
+{"RetroUSB.com RetroPad","0300000000f000000300000000000000",{{2,1,0,0},{2,5,0,0},{2,0,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"RetroUSB.com Super RetroPort","0300000000f00000f100000000000000",{{2,1,0,0},{2,5,0,0},{2,0,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8Bitdo NES30 Pro","03000000022000000090000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Nostromo N45","030000000d0500000308000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,10,0,0},{2,9,0,0},{2,12,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Hori Pad 3 Turbo","030000000d0f00000900000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"REAL ARCADE PRO.3","030000000d0f00001100000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"HORI Real Arcade Pro EX-SE (Xbox 360)","030000000d0f00001600000000007803",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,5,1,0}}},
+{"REAL ARCADE Pro.V3","030000000d0f00002200000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"FIGHTING STICK V3","030000000d0f00002700000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Fighting Commander 3 Pro","030000000d0f00002d00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Fighting Stick Mini 3","030000000d0f00004000000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,5,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,6,0,0}}},
+{"Hatsune Miku Sho Controller","030000000d0f00004900000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Pad A","030000000d0f00004d00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Pad 3","030000000d0f00005400000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Horipad 4 FPS","030000000d0f00005500000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Real Arcade Pro.V4","030000000d0f00005b00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Real Arcade Pro.V4","030000000d0f00005c00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Fighting Commander 4 (PS4)","030000000d0f00005e00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Hori Fighting Commander 4 (PS3)","030000000d0f00005f00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HORIPAD 4 (PS4)","030000000d0f00006600000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Real Arcade Pro.4","030000000d0f00006a00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Real Arcade Pro.4","030000000d0f00006b00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HORIPAD 4 (PS3)","030000000d0f00006e00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"REAL ARCADE PRO.4 VLX","030000000d0f00007000000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Fighting Commander 5","030000000d0f00008400000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Fighting Commander 2016 PS3","030000000d0f00008500000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Fighting Stick mini 4","030000000d0f00008700000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Fighting Stick mini 4","030000000d0f00008800000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Real Arcade Pro.4","030000000d0f00008a00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Real Arcade Pro.4","030000000d0f00008b00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Pokken Tournament DX Pro Pad","030000000d0f00009200000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori TAC Pro","030000000d0f00009c00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Horipad","030000000d0f0000c100000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HORIPAD mini4","030000000d0f0000ee00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PS360+ v1.66","03000000100000008200000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{3,4,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"PS1 Controller","03000000100800000100000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Havit HV-G60","030000001008000001e1000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"NEXT SNES Controller","030000001008000001e5000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0}}},
+{"PS2 Controller","03000000100800000300000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,4,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"uRage Gamepad","03000000101c0000171c000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"8Bitdo SFC30 GamePad","03000000102800000900000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"SteelSeries","03000000110100001914000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"SteelSeries Stratus Duo","03000000110100003114000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"ZEROPLUS P4 Wired Gamepad","03000000120c0000101e000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Brook Mars","03000000120c0000210e000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"P4 Wired Gamepad","03000000120c0000f60e000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,5,0,0},{2,4,0,0},{2,12,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,7,0,0},{2,6,0,0}}},
+{"Elite","03000000120c0000f61c000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"NGDS","03000000152000000182000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"XiaoMi Game Controller","03000000172700004431000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,20,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,8,0,0},{1,7,1,0}}},
+{"8Bitdo NES30 Pro","03000000203800000900000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"QANBA DRONE ARCADE JOYSTICK","03000000222c00000020000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,3,1,0},{1,4,1,0}}},
+{"Qanba Obsidian Arcade Joystick PS4 Mode","03000000222c00000023000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,13,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Qanba Obsidian Arcade Joystick PS3 Mode","03000000222c00000223000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"JYS Wireless Adapter","03000000242f00002d00000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mayflash Magic NS","03000000242f00007300000000000000",{{2,1,0,0},{2,4,0,0},{2,0,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"JYS Wireless Adapter","03000000242f00008a00000000000000",{{2,1,0,0},{2,4,0,0},{2,0,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"HRAP2 on PS/SS/N64 Joypad to USB BOX","03000000250900000017000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,5,0,0},{2,7,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,6,0,0}}},
+{"Mayflash Arcade Stick","03000000250900000128000000000000",{{2,1,0,0},{2,2,0,0},{2,5,0,0},{2,6,0,0},{2,0,0,0},{2,3,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,7,0,0}}},
+{"PS3 Controller","03000000250900000500000000000000",{{2,2,0,0},{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,8,0,0},{3,4,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"MP-8866 Super Dual Box","03000000250900006688000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"PS2 Controller","03000000250900008888000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Mayflash Wii Classic Controller","0300000025090000e803000000000000",{{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{2,11,0,0},{2,14,0,0},{2,13,0,0},{2,12,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Gamecube Controller","03000000260900002625000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,7,0,0},{2,6,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"Cyber Gadget GameCube Controller","03000000260900008888000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{2,6,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,-1,0},{1,5,1,0},{1,4,1,0}}},
+{"GamePad Pro USB","03000000280400000140000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Matricom","030000002a0600001024000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"QanBa Arcade JoyStick 1008","03000000300f00000011000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"USB 4-Axis 12-Button Gamepad","03000000300f00000701000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"GGE909 Recoil Pad","03000000300f00000b01000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Saitek P480 Rumble Pad","03000000300f00001001000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Saitek Rumble Pad","03000000300f00001101000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,6,0,0},{0,0,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Saitek Dual Analog Pad","03000000300f00001201000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"QanBa Joystick Plus","03000000300f00001210000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"QanBa Arcade JoyStick 4018","03000000300f00001611000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Razer Hydra","03000000321500000003000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{0,0,0,0},{1,2,1,0}}},
+{"Razer Raion Fightpad for PS4","03000000321500000011000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Razer Panthera (PS4)","03000000321500000104000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Razer Panthera (PS3)","03000000321500000204000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Razer Raiju Mobile","03000000321500000507000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Razer Raiju Mobile","03000000321500000707000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"vJoy Device","0300000034120000adbe000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,9,0,0},{2,10,0,0},{2,15,0,0},{2,4,0,0},{2,16,0,0},{2,13,0,0},{2,14,0,0},{2,5,0,0},{2,8,0,0},{2,6,0,0},{2,7,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,11,0,0},{2,12,0,0}}},
+{"QanBa Joystick Q4RAF","03000000341a00000104000000000000",{{2,5,0,0},{2,6,0,0},{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,7,0,0}}},
+{"EXEQ RF USB Gamepad 8206","03000000341a00000108000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,8,0,0},{2,7,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{0,0,0,0},{0,0,0,0}}},
+{"SL-6555-SBK","03000000341a00000208000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{1,4,2,1},{1,4,1,0}}},
+{"Hama Scorpad","03000000341a00000302000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Xeox","03000000341a00000608000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"SL-6566","03000000341a00000908000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"USB gamepad","03000000341a00002308000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Afterglow PS3 Controller","03000000341a00003608000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"OUYA Game Controller","03000000362800000100000000000000",{{2,0,0,0},{2,3,0,0},{2,1,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{0,0,0,0},{2,14,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,11,0,0},{2,9,0,0},{2,10,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{2,13,0,0}}},
+{"MadCatz SFIV FightStick PS3","03000000380700001888000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,5,0,0},{2,4,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,7,0,0},{2,6,0,0}}},
+{"Madcatz Arcade Fightstick TE S+ PS3","03000000380700003888000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz FightPad PRO (PS3)","03000000380700005032000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz FightPad PRO (PS4)","03000000380700005082000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS3 RF pad","030000003807000056a8000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz Micro C.T.R.L.R","03000000380700006252000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"MLG GamePad PS3 Controller","03000000380700006382000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz C.T.R.L.R","03000000380700006652000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz TE2 PS3 Fightstick","03000000380700008034000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"MADCATZ SFV Arcade FightStick Alpha PS4","03000000380700008081000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz TE2 PS4 Fightstick","03000000380700008084000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Mad Catz FightStick TE2+ PS3","03000000380700008134000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,7,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,4,0,0}}},
+{"Mad Catz FightStick TE2+ PS4","03000000380700008184000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,5,0,0},{2,4,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,4,1,0},{2,7,0,0}}},
+{"Mad Catz FightStick TE S+ (PS3)","03000000380700008433000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz FightStick TE S+ (PS4)","03000000380700008483000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Madcatz Arcade Fightstick TE S PS3","03000000380700008532000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"SteelSeries Free","03000000381000001214000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,12,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{0,0,0,0},{0,0,0,0}}},
+{"SteelSeries Stratus XL","03000000381000001814000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,18,0,0},{2,9,0,0},{2,19,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,15,0,0},{2,13,0,0},{2,14,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"XEOX Gamepad SL-6556-BK","03000000450c00002043000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Genius Maxfire Grandias 12","03000000451300000010000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Defender Game Racer X7","03000000451300000830000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Cobra","03000000457500000401000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"SZMY-POWER PC Gamepad","03000000457500002211000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Ipega PG-9023","03000000491900000204000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Amazon Luna Controller","03000000491900001904000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"NYKO AIRFLO","030000004b120000014d000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{1,3,1,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{1,0,1,0},{1,2,1,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"PlayStation Vita","030000004c0500003713000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{2,14,0,0},{2,13,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{0,0,0,0},{0,0,0,0}}},
+{"PS3 Controller","030000004c0500006802000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,9,0,0},{2,8,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,-1,0},{1,4,-1,0}}},
+{"PS4 Controller","030000004c050000a00b000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","030000004c050000c405000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","030000004c050000cc09000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PlayStation Classic Controller","030000004c050000da0c000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,5,0,0}}},
+{"PS5 Controller","030000004c050000e60c000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Thrustmaster Firestorm Dual Power","030000004f04000000b3000000000000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,9,0,0},{2,10,0,0},{2,8,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,5,0,0},{2,7,0,0}}},
+{"run'n'drive","030000004f04000003d0000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Thrustmaster Firestorm Dual Power 3","030000004f04000004b3000000000000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,5,0,0},{2,7,0,0}}},
+{"T Mini Wireless","030000004f04000007d0000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"T.16000M","030000004f0400000ab1000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,9,0,0},{2,7,0,0}}},
+{"ThrustMaster eSwap PRO Controller","030000004f0400000ed0000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Thrustmaster Dual Analog 4","030000004f04000015b3000000000000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Thrustmaster Dual Trigger 3-in-1","030000004f04000023b3000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"TWCS Throttle","030000004f04000087b6000000000000",{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{1,5,2,1},{1,5,2,-1}}},
+{"USB gamepad","030000005509000000b4000000000000",{{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,8,0,0},{2,9,0,0},{2,5,0,0},{2,4,0,0},{2,14,0,0},{2,6,0,0},{2,7,0,0},{2,0,0,0},{2,3,0,0},{2,1,0,0},{2,2,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"NVIDIA Controller v01.04","03000000550900001472000000000000",{{2,11,0,0},{2,10,0,0},{2,9,0,0},{2,8,0,0},{2,7,0,0},{2,6,0,0},{2,13,0,0},{2,3,0,0},{2,12,0,0},{2,5,0,0},{2,4,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,6,1,0},{1,4,1,0},{1,5,1,0}}},
+{"Genius MaxFire Grandias 12V","030000005c1a00003330000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,6,0,0},{2,4,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,7,0,0},{2,5,0,0}}},
+{"Xbox Adaptive Controller","030000005e0400000a0b000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,2,-1},{1,2,2,1}}},
+{"Xbox Series Controller","030000005e040000130b000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Controller (XBOX 360 For Windows)","030000005e0400008e02000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,2,-1},{1,2,2,1}}},
+{"Controller (Xbox 360 Wireless Receiver for Windows)","030000005e040000a102000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,2,-1},{1,2,2,1}}},
+{"Controller (Xbox One For Windows) - Wireless","030000005e040000ea02000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,2,-1},{1,2,2,1}}},
+{"Controller (Xbox One For Windows) - Wired","030000005e040000ff02000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,2,-1},{1,2,2,1}}},
+{"Trust Gamepad","030000005f140000c501000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"USB Vibration Joystick (BM)","03000000632500002305000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PS Controller","03000000632500002306000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"HJD-X","03000000632500002605000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"PS3 Controller","03000000632500007505000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"TigerGame PS/PS2 Game Controller Adapter","03000000666600000488000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"PS2 Controller","03000000666600006706000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,11,0,0},{0,0,0,0},{2,9,0,0},{2,10,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Game VIB Joystick","0300000066f700000100000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"BrutalLegendTest","0300000066f700000500000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Bigben PS3 Controller","030000006b1400000055000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Bigben PS3 Controller","030000006b1400000103000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"NACON GC-400ES","030000006b140000010c000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Revolution Pro Controller","030000006b140000010d000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Orange Controller","030000006b14000001a1000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0}}},
+{"USB gamepad","030000006b1400000203000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Revolution Pro Controller 2(1/2)","030000006b140000020d000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS2 Controller","030000006b1400000303000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Revolution Pro Controller 3","030000006b140000130d000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Logitech WingMan RumblePad","030000006d0400000ac2000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,5,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,7,0,0},{2,2,0,0}}},
+{"Logitech Cordless Wingman","030000006d04000011c2000000000000",{{2,0,0,0},{2,1,0,0},{2,4,0,0},{0,0,0,0},{2,9,0,0},{2,10,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0},{2,2,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech Dual Action","030000006d04000016c2000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech F510 Gamepad","030000006d04000018c2000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech F710 Gamepad","030000006d04000019c2000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech Precision Gamepad","030000006d0400001ac2000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech ChillStream","030000006d040000d1ca000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech Cordless Precision","030000006d040000d2ca000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"JC-U3613M (DInput)","030000006e0500000320000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"JC-P301U","030000006e0500000520000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"JC-W01U","030000006e0500000720000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"JC-DUX60 ELECOM MMO Gamepad","030000006e0500000a20000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,8,0,0},{2,11,0,0},{2,17,0,0},{2,20,0,0},{0,0,0,0},{2,14,0,0},{2,15,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,12,0,0},{2,13,0,0}}},
+{"U4113","030000006e0500001320000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Afterglow PS3 Controller","030000006f0e00000263000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Victrix Pro Fight Stick for PS4","030000006f0e00000302000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Victrix Pro Fight Stick for PS4","030000006f0e00000702000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"PDP Versus Fighting Pad","030000006f0e00000901000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Afterglow PS3 Controller","030000006f0e00001101000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Afterglow PS3 Controller","030000006f0e00001401000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Afterglow PS3 Controller","030000006f0e00001402000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Afterglow","030000006f0e00001413000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Afterglow PS3 Controller","030000006f0e00001901000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Afterglow PS3 Controller","030000006f0e00001a01000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Rock Candy PS3 Controller","030000006f0e00001e01000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"INJUSTICE FightStick PS3 Controller","030000006f0e00002401000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Rock Candy PS3 Controller","030000006f0e00002801000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Rock Candy PS3 Controller","030000006f0e00002f01000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"EA SPORTS PS3 Controller","030000006f0e00003001000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Battlefield 4 PS3 Controller","030000006f0e00003201000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Faceoff Wired Pro Controller for Nintendo Switch","030000006f0e00008001000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Faceoff Deluxe+ Audio Wired Controller for Nintendo Switch","030000006f0e00008401000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Amazon Luna Controller","03000000710100001904000000000000",{{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,2,0,0},{2,5,0,0},{2,4,0,0},{2,10,0,0},{2,6,0,0},{2,11,0,0},{2,8,0,0},{2,7,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{0,0,0,0},{0,0,0,0}}},
+{"Sanwa PlayOnline Mobile","03000000730700000401000000000000",{{2,0,0,0},{2,1,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Onlive Wireless Controller","03000000782300000a10000000000000",{{2,15,0,0},{2,14,0,0},{2,13,0,0},{2,12,0,0},{2,11,0,0},{2,10,0,0},{2,7,0,0},{2,6,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"XInput Controller","03000000786901006e70000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Mayflash WiiU Pro Game Controller Adapter (DInput)","03000000790000000018000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"King PS3 Controller","03000000790000000200000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Betop Gamepad","03000000790000000700000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"USB gamepad","03000000790000000a00000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Retrolink SNES Controller","03000000790000001100000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,4,2,1},{1,3,2,-1},{1,4,2,-1},{1,3,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Venom","03000000790000001a18000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Venom Arcade Joystick","03000000790000001b18000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"STK-7024X","03000000790000001c18000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Game Controller for PC","03000000790000002201000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mega Drive","03000000790000002418000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,2,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Mayflash GameCube Controller Adapter","03000000790000004318000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,7,0,0},{2,0,0,0},{2,9,0,0},{2,0,0,0},{2,0,0,0},{2,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Mayflash GameCube Controller","03000000790000004418000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0}}},
+{"NEXILUX GAMECUBE Controller Adapter","03000000790000004518000000000000",{{2,1,0,0},{2,0,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0}}},
+{"GameCube Controller Adapter","03000000790000004618000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"ZD-T Android","03000000790000004f18000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Mayflash Magic NS","0300000079000000d218000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Dual Box WII","03000000791d00000103000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Gravis Eliminator GamePad Pro","030000007d0400000540000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Nintendo Switch Pro Controller","030000007e0500000920000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Betop Gamepad","03000000808300000300000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Genius","030000008305000009a0000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Genius Maxfire Blaze 3","030000008305000031b0000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"iBuffalo SNES Controller","03000000830500006020000000000000",{{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"FF-GP1","03000000852100000201000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PS3 Controller","03000000888800000803000000000000",{{2,2,0,0},{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,11,0,0},{2,12,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,8,0,0},{3,4,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Piranha xtreme","030000008f0e00000300000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"SpeedLink Strike FX","030000008f0e00000800000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"DualShock 2","030000008f0e00000910000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,11,0,0},{0,0,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"GAMEPAD 3 TURBO","030000008f0e00000d31000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"EXEQ","030000008f0e00000f31000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mayflash USB Adapter for original Sega Saturn controller","030000008f0e00001030000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,2,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0},{2,7,0,0}}},
+{"Acme GA-02","030000008f0e00001200000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"HuiJia SNES Controller","030000008f0e00001330000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"PS3 Controller","030000008f0e00001431000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PS1 Controller","030000008f0e00007530000000000000",{{0,0,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,1,0,0}}},
+{"NES 2-port Adapter","03000000921200004b46000000000000",{{2,1,0,0},{2,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Saturn_Adapter_2.0","030000009b2800000500000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,5,0,0}}},
+{"GC/N64 to USB v3.4","030000009b2800003200000000000000",{{2,0,0,0},{2,7,0,0},{2,1,0,0},{2,8,0,0},{0,0,0,0},{2,2,0,0},{0,0,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,10,0,0},{2,13,0,0},{2,11,0,0},{2,12,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,5,2,-1},{1,2,2,-1}}},
+{"GC/N64 to USB v3.6","030000009b2800006000000000000000",{{2,0,0,0},{2,7,0,0},{2,1,0,0},{2,8,0,0},{0,0,0,0},{2,2,0,0},{0,0,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,10,0,0},{2,13,0,0},{2,11,0,0},{2,12,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,5,2,-1},{1,2,2,-1}}},
+{"PS2 Controller","030000009d0d00001330000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,5,0,0},{2,7,0,0}}},
+{"MaxJoypad Virtual Controller","030000009f000000adbb000000000000",{{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"8Bitdo Zero GamePad","03000000a00500003232000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,2,2,1},{1,0,2,-1},{1,2,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Saitek P220","03000000a30600000701000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,6,0,0},{2,4,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,7,0,0},{2,5,0,0}}},
+{"Saitek P990","03000000a30600000b04000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Saitek P990 Dual Analog Pad","03000000a30600000b04000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Saitek P2900","03000000a30600000c04000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,12,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Saitek P2500 Force Rumble Pad","03000000a30600000cff000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,11,0,0},{2,10,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Saitek Cyborg","03000000a30600001af5000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Saitek PS2700","03000000a306000020f6000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Saitek PS1000","03000000a30600002106000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Cyborg V.3 Rumble Pad","03000000a306000022f6000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{1,3,2,-1},{1,3,2,1}}},
+{"Saitek Cyborg V.1 Game pad","03000000a306000023f6000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Sega Mega Drive Mini 6B controller","03000000a30c00002400000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{0,0,0,0},{2,4,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,4,2,1},{1,3,2,-1},{1,4,2,-1},{1,3,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0}}},
+{"Sega Genesis Mini 3B controller","03000000a30c00002500000000000000",{{2,2,0,0},{2,1,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,4,2,1},{1,3,2,-1},{1,4,2,-1},{1,3,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0}}},
+{"Astro City Mini","03000000a30c00002700000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{0,0,0,0},{2,4,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,3,1,0},{1,4,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0}}},
+{"Astro City Mini","03000000a30c00002800000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{0,0,0,0},{2,4,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,3,1,0},{1,4,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0}}},
+{"IPEGA","03000000ac0500002c02000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"GameSir","03000000ac0500003d03000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"GameSir","03000000ac0500004d04000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Xiaoji Gamesir-G3w","03000000ac0500005b05000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Techmobility X6-38V","03000000b50700001203000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Impact Black","03000000b50700001403000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Trust Gamepad","03000000b80500000210000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Elecom Gamepad","03000000b80500000410000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Elecom Gamepad","03000000b80500000610000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Betop BFM Gamepad","03000000bc2000000055000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Betop 2126F","03000000bc2000006012000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Betop Controller","03000000bc2000006312000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"BETOP CONTROLLER","03000000bc2000006321000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Betop Controller","03000000bc2000006412000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Dual USB Vibration Joystick","03000000bd12000002e0000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,11,0,0},{0,0,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"JY-P70UR","03000000bd12000003c0000000000000",{{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,2,0,0},{2,6,0,0},{2,8,0,0},{2,5,0,0},{2,4,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,7,0,0},{2,9,0,0}}},
+{"Joypad Alpha Shock","03000000bd12000003c0000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Retrolink USB SEGA Saturn Classic","03000000bd12000013d0000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,2,0,0},{0,0,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Nintendo Retrolink USB Super SNES Classic Controller","03000000bd12000015d0000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"GameStop PS4 Fun Controller","03000000c01100000140000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"ACRUX USB GAME PAD","03000000c01100000355000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Betop Controller","03000000c01100000555000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Speedlink Torid","03000000c01100000591000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Betop Controller","03000000c01100000655000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Battalife Joystick","03000000c01100001352000000000000",{{2,6,0,0},{2,7,0,0},{2,4,0,0},{2,5,0,0},{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"MOGA XP5-X Plus","03000000c62400001a89000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"MOGA XP5-X Plus","03000000c62400001b89000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"MOGA XP5-A Plus","03000000c62400002a89000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,15,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"MOGA XP5-A Plus","03000000c62400002b89000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30","03000000c82d00000030000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo Wireless Adapter","03000000c82d00000031000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8Bitdo SF30 Pro","03000000c82d00000060000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8Bitdo SF30 Pro","03000000c82d00000061000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo FC30 Pro","03000000c82d00000090000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30 Pro for Android","03000000c82d00000121000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SF30","03000000c82d00000130000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo M30 ModKit","03000000c82d00000151000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{0,0,0,0},{2,6,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,2,2,1},{1,0,2,-1},{1,2,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,7,0,0}}},
+{"8BitDo SN30 Pro","03000000c82d00000160000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30 Pro","03000000c82d00000161000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo N30 Pro","03000000c82d00000190000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30 Pro+","03000000c82d00000260000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30 Pro+","03000000c82d00000261000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo N30","03000000c82d00000310000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo SN30 Modkit","03000000c82d00000351000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,2,2,1},{1,0,2,-1},{1,2,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo Pro 2","03000000c82d00000360000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo N30 Modkit","03000000c82d00000451000000000000",{{2,1,0,0},{2,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,2,2,1},{1,0,2,-1},{1,2,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo M30","03000000c82d00000650000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{1,4,1,0},{2,6,0,0},{0,0,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{1,5,1,0},{2,7,0,0}}},
+{"8BitDo Dogbone Modkit","03000000c82d00000951000000000000",{{2,1,0,0},{2,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo F30 Pro","03000000c82d00001038000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo F30","03000000c82d000011ab000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30","03000000c82d00001290000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo N30 Pro 2","03000000c82d00001590000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo Zero 2","03000000c82d00001890000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo N30","03000000c82d00002028000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8bitdo","03000000c82d00002038000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30","03000000c82d000020ab000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SFC30","03000000c82d000021ab000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo S30 Modkit","03000000c82d00002867000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,8,0,0},{2,6,0,0},{0,0,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,2,2,1},{1,0,2,-1},{1,2,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,9,0,0},{2,7,0,0}}},
+{"8Bitdo SFC30 GamePad","03000000c82d00003028000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo Zero 2","03000000c82d00003032000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo SN30","03000000c82d00004028000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo M30 Gamepad","03000000c82d00005106000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30","03000000c82d00006228000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo N30 Pro 2","03000000c82d00006528000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo N30","03000000c82d00008010000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Stadia Controller","03000000d11800000094000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,12,0,0},{2,11,0,0}}},
+{"Mayflash Magic NS","03000000d620000010a7000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Switch","03000000d620000011a7000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"NSW wired controller","03000000d620000013a7000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Airflo PS3 Controller","03000000d62000001d57000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"BDA PS4 Fightpad","03000000d62000002a79000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Tournament PS3 Controller","03000000d62000006000000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"OPP PS3 Controller","03000000d62000006d57000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PowerA Pro Ex","03000000d62000006dca000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Pro Elite PS3 Controller","03000000d62000009557000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Pro Ex mini PS3 Controller","03000000d62000009f31000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Pro Ex mini PS3 Controller","03000000d6200000c757000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Batarang","03000000d6200000e557000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HitBox Edition Cthulhu+","03000000d81400000862000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,5,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,6,0,0}}},
+{"BUFFALO BSGP1601 Series ","03000000d81d00000b00000000000000",{{2,5,0,0},{2,3,0,0},{2,4,0,0},{2,2,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,13,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"iBUFFALO BSGP1204 Series","03000000d81d00000f00000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"iBUFFALO BSGP1204P Series","03000000d81d00001000000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"TwinShock PS2","03000000d90400000200000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"PS to USB convert cable","03000000e30500009605000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Cideko AK08b","03000000e82000006058000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"AxisPad","03000000ef0500000300000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Monect Virtual Controller","03000000efbe0000edfe000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Gioteck PS3 Controller","03000000f025000021c1000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"USB gamepad","03000000f0250000c183000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Gioteck","03000000f0250000c283000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Gioteck VX2 Controller","03000000f0250000c383000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Gioteck VX2 Controller","03000000f0250000c483000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Team 5","03000000fa1900000706000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Acteck AGJ-3200","03000000fa190000f0ff000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"3DRUDDER","03000000fa2d00000100000000000000",{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,1,0},{1,2,1,0},{0,0,0,0},{0,0,0,0}}},
+{"PSP","03000000ff000000cb01000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"SVEN X-PAD","03000000ff1100003133000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,6,0,0},{2,7,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"USB gamepad","03000000ff1100004133000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,4,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"GameStop Gamepad","03000000ffff00000000000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"XInput Gamepad (GLFW)","78696e70757401000000000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"XInput Wheel (GLFW)","78696e70757402000000000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"Fightstick TES","78696e70757403000000000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,5,1,0}}},
+{"XInput Flight Stick (GLFW)","78696e70757404000000000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"XInput Dance Pad (GLFW)","78696e70757405000000000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"XInput Guitar (GLFW)","78696e70757406000000000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"XInput Drum Kit (GLFW)","78696e70757408000000000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+#endif // _GLFW_WIN32
+
+#if defined(_GLFW_COCOA)
+{"SNES RetroPort","0300000000f00000f100000000000000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,5,0,0},{2,7,0,0},{2,4,0,0},{2,6,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8Bitdo NES30 Pro","03000000022000000090000001000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"ASUS Gamepad","03000000050b00000045000031000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,9,0,0},{0,0,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Hori Fighting Commander 3 Pro","030000000d0f00002d00000000100000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HORI Gem Pad 3","030000000d0f00004d00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HORI Fighting Commander 4 PS4","030000000d0f00005e00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Fighting Commander 4 (PS4)","030000000d0f00005e00000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"HORI Fighting Commander 4 PS3","030000000d0f00005f00000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Fighting Commander 4 (PS3)","030000000d0f00005f00000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HORIPAD FPS PLUS 4","030000000d0f00006600000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{1,4,1,0}}},
+{"HORIPAD 4 (PS4)","030000000d0f00006600000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"HORIPAD 4 (PS3)","030000000d0f00006e00000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Pokken Tournament DX Pro Pad","030000000d0f00009200000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"HORIPAD mini4","030000000d0f0000ee00000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Twin USB Joystick","03000000100800000100000000000000",{{2,4,0,0},{2,2,0,0},{2,6,0,0},{2,0,0,0},{2,12,0,0},{2,14,0,0},{2,16,0,0},{2,18,0,0},{0,0,0,0},{2,20,0,0},{2,22,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,2,1,0},{1,6,1,0},{1,4,1,0},{2,8,0,0},{2,10,0,0}}},
+{"NEXT SNES Controller","030000001008000001e5000006010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0}}},
+{"PS2 Adapter","03000000100800000300000006010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{1,4,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"8Bitdo SFC30 GamePad Joystick","03000000102800000900000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"SteelSeries Stratus XL","03000000110100001714000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,8,0,0},{2,10,0,0},{2,9,0,0},{2,11,0,0}},{{1,0,1,0},{1,1,-1,0},{1,2,1,0},{1,3,-1,0},{2,6,0,0},{2,7,0,0}}},
+{"SteelSeries Stratus XL","03000000110100001714000020010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,8,0,0},{2,10,0,0},{2,9,0,0},{2,11,0,0}},{{1,0,1,0},{1,1,-1,0},{1,2,1,0},{1,3,-1,0},{2,6,0,0},{2,7,0,0}}},
+{"SteelSeries Nimbus","03000000110100002014000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,8,0,0},{2,10,0,0},{2,9,0,0},{2,11,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"SteelSeries Nimbus","03000000110100002014000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{2,8,0,0},{2,10,0,0},{2,9,0,0},{2,11,0,0}},{{1,0,1,0},{1,1,-1,0},{1,2,1,0},{1,3,-1,0},{2,6,0,0},{2,7,0,0}}},
+{"ZEROPLUS P4 Gamepad","03000000120c0000100e000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"ZEROPLUS P4 Wired Gamepad","03000000120c0000101e000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Brook Mars","03000000120c0000200e000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Brook Mars","03000000120c0000210e000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"XiaoMi Game Controller","03000000172700004431000029010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,15,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,8,0,0},{1,6,1,0}}},
+{"8Bitdo NES30 Pro","03000000203800000900000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"JYS Wireless Adapter","03000000242f00002d00000007010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mayflash Magic NS","03000000242f00007300000000020000",{{2,1,0,0},{2,4,0,0},{2,0,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Mayflash Wii Classic Controller","0300000025090000e803000000000000",{{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{2,11,0,0},{2,14,0,0},{2,13,0,0},{2,12,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Cyber Gadget GameCube Controller","03000000260900008888000088020000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{2,6,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,-1,0},{1,4,1,0},{1,5,1,0}}},
+{"Gravis Gamepad Pro","03000000280400000140000000020000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Razer Serval","03000000321500000009000000020000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Razer Serval","030000003215000000090000163a0000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Razer RAIJU","03000000321500000010000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Razer Raion Fightpad for PS4","03000000321500000011000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Razer Panthera (PS4)","03000000321500000104000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Razer Panthera (PS3)","03000000321500000204000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Razer Wildcat","0300000032150000030a000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Razer Raiju Mobile","03000000321500000507000001010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,21,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"8BitDo NES30 Gamepad","030000003512000012ab000001000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"SFC30 Joystick","030000003512000021ab000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Mad Catz FightPad PRO (PS3)","03000000380700005032000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz FightPad PRO (PS4)","03000000380700005082000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Mad Catz FightStick TE S+ (PS3)","03000000380700008433000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz FightStick TE S+ (PS4)","03000000380700008483000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"SteelSeries Nimbus","03000000381000002014000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{2,8,0,0},{2,10,0,0},{2,9,0,0},{2,11,0,0}},{{1,0,1,0},{1,1,-1,0},{1,2,1,0},{1,3,-1,0},{2,6,0,0},{2,7,0,0}}},
+{"SZMY-POWER PC Gamepad","03000000457500002211000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Amazon Luna Controller","03000000491900001904000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PlayStation Vita","030000004c0500003713000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{2,14,0,0},{2,13,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{0,0,0,0},{0,0,0,0}}},
+{"PS3 Controller","030000004c0500006802000000000000",{{2,14,0,0},{2,13,0,0},{2,15,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{2,0,0,0},{2,3,0,0},{2,16,0,0},{2,1,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"PS3 Controller","030000004c0500006802000000010000",{{2,14,0,0},{2,13,0,0},{2,15,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{2,0,0,0},{2,3,0,0},{2,16,0,0},{2,1,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Sony DualShock 4 Wireless Adaptor","030000004c050000a00b000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,13,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","030000004c050000a00b000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","030000004c050000c405000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","030000004c050000c405000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Sony DualShock 4 V2","030000004c050000cc09000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,13,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","030000004c050000cc09000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Playstation Classic Controller","030000004c050000da0c000000010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,5,0,0}}},
+{"Sony DualSense","030000004c050000e60c000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Thrustmaster Firestorm Dual Power","030000004f04000000b3000000000000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,9,0,0},{2,10,0,0},{2,8,0,0},{2,11,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,5,0,0},{2,7,0,0}}},
+{"ThrustMaster eSwap PRO Controller","030000004f0400000ed0000000020000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Thrustmaster Dual Analog 3.2","030000004f04000015b3000000000000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,5,0,0},{2,7,0,0}}},
+{"NVIDIA Controller v01.04","03000000550900001472000025050000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,17,0,0},{2,6,0,0},{2,15,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Xbox Elite Wireless Controller Series 2","030000005e040000050b000003090000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,31,0,0},{2,11,0,0},{2,53,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,6,1,0},{1,5,1,0}}},
+{"Xbox Adaptive Controller","030000005e0400000a0b000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox Series Controller","030000005e040000130b000001050000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Xbox Series Controller","030000005e040000130b000005050000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Microsoft SideWinder Plug & Play Game Pad","030000005e0400002700000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,5,0,0}}},
+{"X360 Controller","030000005e0400008e02000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Steam Virtual Gamepad","030000005e0400008e02000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox One Wired Controller","030000005e040000d102000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox One Wired Controller","030000005e040000dd02000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox Wireless Controller","030000005e040000e002000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox Wireless Controller","030000005e040000e002000003090000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox One Wired Controller","030000005e040000e302000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox Wireless Controller","030000005e040000ea02000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox Wireless Controller","030000005e040000fd02000003090000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,16,0,0},{2,11,0,0},{2,15,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"NEOGEO mini PAD Controller","03000000632500007505000000020000",{{2,1,0,0},{2,0,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Revolution Pro Controller","030000006b140000010d000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Revolution Pro Controller 3","030000006b140000130d000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Logitech F310 Gamepad (DInput)","030000006d04000016c2000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech Dual Action","030000006d04000016c2000000020000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech Dual Action","030000006d04000016c2000000030000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech Dual Action","030000006d04000016c2000014040000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech F510 Gamepad (DInput)","030000006d04000018c2000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech RumblePad 2 USB","030000006d04000018c2000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,-1,0},{1,2,1,0},{1,3,-1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech Wireless Gamepad (DInput)","030000006d04000019c2000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech F710","030000006d04000019c2000005030000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech F710 Gamepad (XInput)","030000006d0400001fc2000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"GameStop Xbox 360 Wired Controller","030000006f0e00000102000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox 360 Wired Controller","030000006f0e00000104000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Victrix Pro Fight Stick for PS4","030000006f0e00000302000025040000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Victrix Pro Fight Stick for PS4","030000006f0e00000702000003060000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"PDP Versus Fighting Pad","030000006f0e00000901000002010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Amazon Luna Controller","03000000710100001904000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,11,0,0},{2,6,0,0},{2,10,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Sanwa PlayOnline Mobile","03000000730700000401000000010000",{{2,0,0,0},{2,1,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Mayflash WiiU Pro Game Controller Adapter (DInput)","03000000790000000018000000000000",{{2,4,0,0},{2,8,0,0},{2,0,0,0},{2,12,0,0},{2,16,0,0},{2,20,0,0},{2,32,0,0},{2,36,0,0},{0,0,0,0},{2,40,0,0},{2,44,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,4,1,0},{1,8,1,0},{1,12,1,0},{2,24,0,0},{2,28,0,0}}},
+{"Mayflash Wii U Pro Controller Adapter","03000000790000000018000000010000",{{2,4,0,0},{2,8,0,0},{2,0,0,0},{2,12,0,0},{2,16,0,0},{2,20,0,0},{2,32,0,0},{2,36,0,0},{0,0,0,0},{2,40,0,0},{2,44,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,4,1,0},{1,8,1,0},{1,12,1,0},{2,24,0,0},{2,28,0,0}}},
+{"Marvo GT-004","03000000790000000600000007010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Retrolink Classic Controller","03000000790000001100000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,3,1,0},{1,4,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Retrolink SNES Controller","03000000790000001100000006010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,4,2,1},{1,3,2,-1},{1,4,2,-1},{1,3,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Mayflash GameCube Controller","03000000790000004418000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0}}},
+{"GameCube Controller Adapter","03000000790000004618000000010000",{{2,4,0,0},{2,0,0,0},{2,8,0,0},{2,12,0,0},{0,0,0,0},{2,28,0,0},{0,0,0,0},{2,36,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,48,0,0},{2,52,0,0},{2,56,0,0},{2,60,0,0}},{{1,0,1,0},{1,4,1,0},{1,20,1,0},{1,8,1,0},{1,12,1,0},{1,16,1,0}}},
+{"Mayflash Magic NS","0300000079000000d218000026010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Wii Classic Controller","03000000791d00000103000009010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Gravis Eliminator GamePad Pro","030000007d0400000540000001010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Nintendo Switch Pro Controller","030000007e0500000920000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Nintendo Switch Pro Controller","030000007e0500000920000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Sega Saturn","03000000811700007e05000000000000",{{2,2,0,0},{2,4,0,0},{2,0,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,13,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,17,0,0},{2,14,0,0},{2,16,0,0},{2,15,0,0}},{{1,0,1,0},{1,2,1,0},{0,0,0,0},{0,0,0,0},{1,5,1,0},{1,4,1,0}}},
+{"Cideko AK08b","030000008305000031b0000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"iBuffalo USB 2-axis 8-button Gamepad","03000000830500006020000000000000",{{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"iBuffalo SNES Controller","03000000830500006020000000010000",{{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Razer Onza TE","030000008916000000fd000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Piranha xtreme","030000008f0e00000300000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"GreenAsia Inc. USB Joystick","030000008f0e00000300000007010000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"2In1 USB Joystick","030000008f0e00000300000009010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HuiJia SNES Controller","030000008f0e00001330000011010000",{{2,4,0,0},{2,2,0,0},{2,6,0,0},{2,0,0,0},{2,12,0,0},{2,14,0,0},{2,16,0,0},{2,18,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,2,2,1},{1,0,2,-1},{1,2,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"NES 2-port Adapter","03000000921200004b46000003020000",{{2,1,0,0},{2,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8Bitdo Zero GamePad","03000000a00500003232000008010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8Bitdo Zero GamePad","03000000a00500003232000009010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Cyborg V.3 Rumble Pad","03000000a306000022f6000001030000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{1,3,2,-1},{1,3,2,1}}},
+{"Astro City Mini","03000000a30c00002700000003030000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{0,0,0,0},{2,4,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,3,1,0},{1,4,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0}}},
+{"Astro City Mini","03000000a30c00002800000003030000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{0,0,0,0},{2,4,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,3,1,0},{1,4,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0}}},
+{"Gamestop BB-070 X360 Controller","03000000ad1b000001f9000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Sega Saturn USB Gamepad","03000000b40400000a01000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,5,0,0},{2,8,0,0},{2,2,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Tomee SNES USB Controller","03000000bd12000015d0000000000000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Tomee SNES USB Controller","03000000bd12000015d0000000010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"GameStop PS4 Fun Controller","03000000c01100000140000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Xbox 360 Wired Controller","03000000c6240000045d000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"BDA MOGA XP5-X Plus","03000000c62400001a89000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0},{2,16,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"BDA MOGA XP5-X Plus","03000000c62400001b89000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"MOGA XP5-A Plus","03000000c62400002a89000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,21,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"MOGA XP5-A Plus","03000000c62400002b89000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Xbox One PowerA Wired Controller","03000000c62400003a54000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Rock Candy Gamepad for PS3","03000000c6240000fefa000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"8BitDo Wireless Adapter","03000000c82d00000031000001000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo FC30 Pro","03000000c82d00000090000001000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"8BitDo SN30 Pro","03000000c82d00000160000001000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"8BitDo SN30 Pro","03000000c82d00000161000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8Bitdo NES30 Pro","03000000c82d00000190000001000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30 Pro+","03000000c82d00000260000001000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30 Pro+","03000000c82d00000261000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo M30","03000000c82d00000650000001000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,8,0,0},{2,6,0,0},{0,0,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,9,0,0},{2,7,0,0}}},
+{"8BitDo FC30 Pro","03000000c82d00001038000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"8BitDo SN30 Gamepad","03000000c82d00001290000001000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo N30 Pro 2","03000000c82d00001590000001000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"8BitDo Zero 2","03000000c82d00001890000001000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo Zero 2","03000000c82d00003032000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,31,1,0},{0,0,0,0},{0,0,0,0}}},
+{"8Bitdo SN30 GamePad","03000000c82d00004028000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo M30 Gamepad","03000000c82d00005106000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{1,5,1,0},{1,4,1,0}}},
+{"8BitDo N30 Pro 2","03000000c82d00006528000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Stadia Controller","03000000d11800000094000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Mayflash Magic NS","03000000d620000010a7000003010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Nintendo Switch Core (Plus) Wired Controller","03000000d620000011a7000000020000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Nintendo Switch PowerA Wired Controller","03000000d620000011a7000010050000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"BDA PS4 Fightpad","03000000d62000002a79000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PowerA Pro Ex","03000000d62000006dca000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Moga Pro 2 HID","03000000d62000007162000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,6,0,0},{0,0,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"MC Cthulhu","03000000d8140000cecf000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"AxisPad","03000000ef0500000300000000020000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"GameStop Gamepad","0500000047532047616d657061640000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PS5 Controller","050000004c050000e60c000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"SteelSeries Nimbus Plus","050000004e696d6275732b0000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,15,0,0},{2,14,0,0},{2,16,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,12,0,0},{2,11,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,-1,0},{1,2,1,0},{1,3,-1,0},{2,6,0,0},{2,7,0,0}}},
+{"Wii Remote","050000005769696d6f74652028303000",{{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,9,0,0},{2,11,0,0},{0,0,0,0},{2,7,0,0},{2,6,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{0,0,0,0}}},
+{"Wii U Pro Controller","050000005769696d6f74652028313800",{{2,16,0,0},{2,15,0,0},{2,18,0,0},{2,17,0,0},{2,19,0,0},{2,20,0,0},{2,7,0,0},{2,6,0,0},{2,8,0,0},{2,23,0,0},{2,24,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,21,0,0},{2,22,0,0}}},
+#endif // _GLFW_COCOA
+
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
+{"Xbox 360 Wireless Controller","0000000058626f782033363020576900",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,14,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,13,0,0},{2,11,0,0},{2,12,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox Gamepad (userspace driver)","0000000058626f782047616d65706100",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"RetroPad","0300000000f000000300000000010000",{{2,1,0,0},{2,5,0,0},{2,0,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Super RetroPort","0300000000f00000f100000000010000",{{2,1,0,0},{2,5,0,0},{2,0,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8Bitdo NES30 Pro","03000000022000000090000011010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Miroof","03000000030000000300000002000000",{{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Competition Pro","030000000b0400003365000000010000",{{2,0,0,0},{2,1,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Nostromo n45 Dual Analog Gamepad","030000000d0500000308000010010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,10,0,0},{2,9,0,0},{2,12,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Natec Genesis P44","030000000d0f00000900000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"hori","030000000d0f00000d00000000010000",{{2,0,0,0},{2,6,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{2,4,0,0},{2,5,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"HORI CO. LTD. FIGHTING STICK 3","030000000d0f00001000000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Real Arcade Pro.EX-SE (Xbox 360)","030000000d0f00001600000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"HORI CO. LTD. REAL ARCADE Pro.V3","030000000d0f00002200000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Fighting Commander 4 (PS4)","030000000d0f00005e00000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Hori Fighting Commander 4 (PS3)","030000000d0f00005f00000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HORIPAD 4 (PS4)","030000000d0f00006600000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"HORIPAD ONE","030000000d0f00006700000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"HORI CO. LTD. Real Arcade Pro.4","030000000d0f00006a00000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"HORI CO. LTD. Real Arcade Pro.4","030000000d0f00006b00000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HORIPAD 4 (PS3)","030000000d0f00006e00000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HORI Fighting Commander","030000000d0f00008500000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Fighting Commander","030000000d0f00008600000002010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Pokken Tournament DX Pro Pad","030000000d0f00009200000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"HORI Real Arcade Pro","030000000d0f0000aa00000011010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HORI CO. LTD. HORIPAD S","030000000d0f0000c100000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,13,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HORI Real Arcade Pro S","030000000d0f0000d800000072056800",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,9,0,0},{2,10,0,0},{2,4,0,0},{2,6,0,0},{2,5,0,0},{2,7,0,0},{2,8,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"HORIPAD mini4","030000000d0f0000ee00000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Akishop Customs PS360+ v1.66","03000000100000008200000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,12,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Twin USB PS2 Adapter","03000000100800000100000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"NEXT SNES Controller","030000001008000001e5000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0}}},
+{"USB Gamepad","03000000100800000300000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Manta Dualshock 2","03000000120c00000500000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"AxisPad","03000000120c00000500000010010000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"ZEROPLUS P4 Gamepad","03000000120c0000100e000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"ZEROPLUS P4 Wired Gamepad","03000000120c0000101e000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Brook Mars","03000000120c0000200e000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Brook Mars","03000000120c0000210e000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Brook Universal Fighting Board","03000000120c0000f70e000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Hyperkin X91","03000000242e00008816000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"JYS Wireless Adapter","03000000242f00002d00000011010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mayflash Magic NS","03000000242f00007300000011010000",{{2,1,0,0},{2,4,0,0},{2,0,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"JYS Wireless Adapter","03000000242f00008a00000011010000",{{2,1,0,0},{2,4,0,0},{2,0,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Magic-S Pro","03000000242f0000f700000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Sony PS2 pad with SmartJoy adapter","03000000250900000500000000010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"MP-8866 Super Dual Box","03000000250900006688000000010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Mayflash Wii Classic Controller","0300000025090000e803000001010000",{{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,2,0,0},{1,4,1,0},{1,5,1,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Cyber Gadget GameCube Controller","03000000260900008888000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{2,6,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,-1,0},{1,4,1,0},{1,5,1,0}}},
+{"Gravis GamePad Pro USB ","03000000280400000140000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Jess Tech GGE909 PC Recoil Pad","03000000300f00000b01000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Jess Tech Dual Analog Rumble Pad","03000000300f00001001000010010000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Saitek P380","03000000300f00001201000010010000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"QanBa Arcade JoyStick","03000000300f00001211000011010000",{{2,2,0,0},{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,5,0,0},{2,7,0,0},{2,10,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,6,0,0}}},
+{"Razer Serval","03000000321500000009000011010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Razer RAIJU","03000000321500000010000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Razer Raion Fightpad for PS4","03000000321500000011000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Razer Panthera (PS4)","03000000321500000104000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Razer Panthera (PS3)","03000000321500000204000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Razer Wildcat","0300000032150000030a000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Razer Raiju Mobile","03000000321500000507000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,21,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Razer Panthera Evo Arcade Stick for PS4","03000000321500000810000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,13,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"GameCube {HuiJia USB box}","03000000341a000005f7000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0}}},
+{"SL-6566","03000000341a00000908000010010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PS3 Controller","03000000341a00003608000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"8Bitdo SFC30 GamePad","030000003512000012ab000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Mad Catz Wired Xbox 360 Controller","03000000380700001647000010040000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"MadCatz PC USB Wired Stick 8818","03000000380700001888000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz Wired Xbox 360 Controller (SFIV)","03000000380700003847000090040000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"MadCatz PC USB Wired Stick 8838","03000000380700003888000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{1,0,1,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz FightPad PRO (PS3)","03000000380700005032000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz FightPad PRO (PS4)","03000000380700005082000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Mad Catz fightstick (PS3)","03000000380700008034000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz fightstick (PS4)","03000000380700008084000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Mad Catz FightStick TE S+ (PS3)","03000000380700008433000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Mad Catz FightStick TE S+ (PS4)","03000000380700008483000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"SteelSeries Stratus Duo","03000000381000003014000075010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"SteelSeries Stratus Duo","03000000381000003114000075010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Suncom SFX Plus for USB","030000003b07000004a1000000010000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,6,0,0},{2,9,0,0},{2,7,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,5,0,0}}},
+{"XEOX Gamepad SL-6556-BK","03000000450c00002043000010010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Genius Maxfire Grandias 12","03000000451300000010000010010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"NYKO CORE","03000000451300000830000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"SZMY-POWER CO. LTD. GAMEPAD","03000000457500002211000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Amazon Luna Controller","03000000491900001904000011010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PlayStation Vita","030000004c0500003713000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{2,14,0,0},{2,13,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{0,0,0,0},{0,0,0,0}}},
+{"PS3 Controller","030000004c0500006802000010010000",{{2,14,0,0},{2,13,0,0},{2,15,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{2,0,0,0},{2,3,0,0},{2,16,0,0},{2,1,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"PS3 Controller","030000004c0500006802000010810000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,16,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS3 Controller","030000004c0500006802000011010000",{{2,14,0,0},{2,13,0,0},{2,15,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{2,0,0,0},{2,3,0,0},{2,16,0,0},{2,1,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"PS3 Controller","030000004c0500006802000011810000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,16,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS4 Controller","030000004c050000a00b000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","030000004c050000a00b000011810000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS4 Controller","030000004c050000c405000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","030000004c050000c405000011810000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS4 Controller","030000004c050000cc09000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","030000004c050000cc09000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","030000004c050000cc09000011810000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Playstation Controller","030000004c050000da0c000011010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,5,0,0}}},
+{"PS5 Controller","030000004c050000e60c000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Sony DualSense","030000004c050000e60c000011810000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Thrustmaster Firestorm Dual Power","030000004f04000000b3000010010000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,9,0,0},{2,10,0,0},{2,8,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Thrustmaster Firestorm Dual Analog 2","030000004f04000003b3000010010000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Dual Power 2","030000004f04000004b3000010010000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Thrustmaster T Mini Wireless","030000004f04000007d0000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Thrustmaster Run N Drive Wireless","030000004f04000008d0000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Thrustmaster Run N Drive Wireless PS3","030000004f04000009d0000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"ThrustMaster eSwap PRO Controller","030000004f0400000ed0000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Thrustmaster vibrating gamepad","030000004f04000012b3000010010000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Thrustmaster Dual Analog 4","030000004f04000015b3000010010000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Thrustmaster 2 in 1 DT","030000004f04000020b3000010010000",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Thrustmaster Dual Trigger 3-in-1","030000004f04000023b3000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Thrustmaster Gamepad GP XID","030000004f04000026b3000002040000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Atari Classic Controller","03000000503200000110000000000000",{{2,0,0,0},{0,0,0,0},{2,1,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Atari Game Controller","03000000503200000210000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"NVIDIA Controller","03000000550900001072000011010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{2,7,0,0},{2,13,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"NVIDIA Controller v01.04","03000000550900001472000011010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,14,0,0},{2,6,0,0},{2,16,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Microsoft Xbox One Elite 2 pad - Wired","030000005e040000000b000008040000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Old Xbox pad","030000005e0400000202000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,2,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Microsoft SideWinder","030000005e0400000e00000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Xbox Series Controller","030000005e040000120b000001050000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"XBox Series pad","030000005e040000120b000005050000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox Series Controller","030000005e040000130b000005050000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"X360 Wireless Controller","030000005e0400001907000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,13,0,0},{2,12,0,0},{2,14,0,0},{2,11,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Microsoft X-Box pad (Japan)","030000005e0400008502000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,2,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Microsoft X-Box pad v2 (US)","030000005e0400008902000021010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,2,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"xbox360 Wireless EasySMX","030000005e0400008e02000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Be1 GC101 Xbox 360 Controller mode","030000005e0400008e02000003030000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Microsoft X-Box 360 pad","030000005e0400008e02000004010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"X360 Controller","030000005e0400008e02000010010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"X360 Controller","030000005e0400008e02000014010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"8BitDo Wireless Adapter (XInput)","030000005e0400008e02000020010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"SpeedLink XEOX Pro Analog Gamepad pad","030000005e0400008e02000020200000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Microsoft X-Box 360 pad","030000005e0400008e02000062230000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Torid","030000005e0400008e02000070050000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Speedlink TORID Wireless Gamepad","030000005e0400008e02000073050000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"X360 Wireless Controller","030000005e0400009102000007010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,13,0,0},{2,12,0,0},{2,14,0,0},{2,11,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"X360 Wireless Controller","030000005e040000a102000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,13,0,0},{2,12,0,0},{2,14,0,0},{2,11,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"X360 Wireless Controller","030000005e040000a102000007010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox 360 Wireless Receiver (XBOX)","030000005e040000a102000014010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,13,0,0},{2,12,0,0},{2,14,0,0},{2,11,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Microsoft X-Box One pad","030000005e040000d102000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox One Controller","030000005e040000d102000002010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Microsoft X-Box One pad v2","030000005e040000d102000003020000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Microsoft X-Box One pad (Firmware 2015)","030000005e040000dd02000003020000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Microsoft X-Box One Elite pad","030000005e040000e302000003020000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox One Wireless Controller","030000005e040000ea02000000000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Xbox One Wireless Controller (Model 1708)","030000005e040000ea02000001030000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Microsoft Xbox One S pad - Wired","030000005e040000ea02000008040000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"SHANWAN Trust Gamepad","030000005f140000c501000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"ShanWan USB Gamepad","03000000632500002305000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"HJD-X","03000000632500002605000010010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"SHANWAN PS3/PC Gamepad","03000000632500007505000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Ipega PG-9099 - Bluetooth Gamepad","03000000632500007505000011010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Super Joy Box 5 Pro","03000000666600000488000000010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"boom PSX to PC Converter","03000000666600006706000000010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,11,0,0},{0,0,0,0},{2,9,0,0},{2,10,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"NACON GC-400ES","030000006b140000010c000010010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Revolution Pro Controller","030000006b140000010d000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Revolution Pro Controller 3","030000006b140000130d000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Logitech Inc. WingMan RumblePad","030000006d0400000ac2000010010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,5,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,7,0,0},{2,2,0,0}}},
+{"Logitech WingMan Cordless RumblePad","030000006d04000011c2000010010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,2,0,0},{2,8,0,0},{2,5,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,9,0,0},{2,10,0,0}}},
+{"Logitech Dual Action","030000006d04000016c2000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech Dual Action","030000006d04000016c2000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech RumblePad 2","030000006d04000018c2000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech Cordless RumblePad 2","030000006d04000019c2000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech F710 Gamepad (DInput)","030000006d04000019c2000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logitech F310 Gamepad (XInput)","030000006d0400001dc2000014400000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Logitech F510 Gamepad (XInput)","030000006d0400001ec2000019200000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Logitech F510 Gamepad (XInput)","030000006d0400001ec2000020200000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Logitech F710 Gamepad (XInput)","030000006d0400001fc2000005030000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Logitech ChillStream","030000006d040000d1ca000000000000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Precision Controller","030000006d040000d2ca000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"JC-U3613M - DirectInput Mode","030000006e0500000320000010010000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Logic3 Controller","030000006f0e00000103000000020000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Gamestop Logic3 Controller","030000006f0e00000104000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Victrix Pro Fight Stick for PS4","030000006f0e00000302000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Victrix Pro Fight Stick for PS4","030000006f0e00000702000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"PDP Versus Fighting Pad","030000006f0e00000901000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Afterglow","030000006f0e00001302000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Generic X-Box pad","030000006f0e00001304000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS3 Controller","030000006f0e00001402000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Rock Candy PS3 Controller","030000006f0e00001e01000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Rock Candy","030000006f0e00001f01000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"EA Sports PS3 Controller","030000006f0e00003001000001010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PDP EA Sports Controller","030000006f0e00003101000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Afterglow Prismatic Controller","030000006f0e00003901000000430000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Afterglow Prismatic Wired Controller 048-007-NA","030000006f0e00003901000013020000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Afterglow Controller for Xbox One","030000006f0e00003901000020060000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Rock Candy Xbox One Controller","030000006f0e00004601000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PDP Battlefield One","030000006f0e00006401000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PDP CO. LTD. Faceoff Wired Pro Controller for Nintendo Switch","030000006f0e00008001000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PDP Wired Fight Pad Pro for Nintendo Switch","030000006f0e00008501000011010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PDP Rock Candy Wired Controller for Nintendo Switch","030000006f0e00008701000011010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,13,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PDP Wired Controller for Xbox One","030000006f0e0000a802000023020000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PDP AFTERGLOW Wired Xbox One Controller","030000006f0e0000b802000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PDP AFTERGLOW Wired Xbox One Controller","030000006f0e0000b802000013020000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PDP Kingdom Hearts Controller","030000006f0e0000c802000012010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Microntek USB Joystick","03000000780000000600000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,5,0,0}}},
+{"USB gamepad","03000000790000000600000007010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"DragonRise Inc. Generic USB Joystick","03000000790000000600000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"USB Gamepad1","03000000790000001100000000010000",{{2,2,0,0},{2,1,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,4,1,0},{1,2,1,0},{1,0,1,0},{1,1,1,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Retrolink SNES Controller","03000000790000001100000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"PC Game Controller","03000000790000001c18000011010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Arcade Fightstick F300","03000000790000003018000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Mayflash GameCube Controller Adapter","03000000790000004318000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Mayflash GameCube Controller","03000000790000004418000010010000",{{2,1,0,0},{2,0,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0}}},
+{"NEXILUX GAMECUBE Controller Adapter","03000000790000004518000010010000",{{2,1,0,0},{2,0,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Nintendo GameCube Controller Adapter","03000000790000004618000010010000",{{2,1,0,0},{2,0,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{2,7,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,5,-1,0},{1,2,-1,0},{2,4,0,0},{2,5,0,0}}},
+{"Mayflash Magic NS","0300000079000000d218000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"GPD Win 2 Controller","0300000079000000d418000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Wii Classic Controller","03000000791d00000103000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Alienware Dual Compatible Game Pad","030000007c1800000006000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Gravis Eliminator GamePad Pro","030000007d0400000540000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Nintendo Switch Pro Controller","030000007e0500000920000011810000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,5,0,0},{2,6,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,7,0,0},{2,8,0,0}}},
+{"Nintendo GameCube Controller","030000007e0500003703000000016800",{{2,0,0,0},{2,2,0,0},{2,1,0,0},{2,3,0,0},{0,0,0,0},{2,9,0,0},{0,0,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,7,0,0},{2,5,0,0},{2,6,0,0},{2,4,0,0}},{{1,0,1,0},{1,1,-1,0},{1,2,1,0},{1,3,-1,0},{1,4,1,0},{1,5,1,0}}},
+{"Retronic Adapter","0300000081170000990a000001010000",{{2,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Padix Co. Ltd. Rockfire PSX/USB Bridge","03000000830500005020000010010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"iBuffalo SNES Controller","03000000830500006020000010010000",{{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Razer Onza Tournament Edition","030000008916000000fd000024010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Razer Sabertooth","030000008916000000fe000024010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Razer Onza Classic Edition","030000008916000001fd000024010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,13,0,0},{2,12,0,0},{2,14,0,0},{2,11,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS3 Controller","030000008f0e00000300000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"GreenAsia Electronics 4Axes 12Keys GamePad ","030000008f0e00000610000000010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,11,0,0},{0,0,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Gasia Co. Ltd PS(R) Gamepad","030000008f0e00000800000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"SZMY-POWER CO. LTD. GAMEPAD 3 TURBO","030000008f0e00000d31000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"GreenAsia Inc. USB Joystick","030000008f0e00001200000010010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"HuiJia SNES Controller","030000008f0e00001330000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"SZMY-POWER CO. LTD. PS3 gamepad","030000008f0e00001431000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"raphnet.net 4nes4snes v1.5","030000009b2800000300000001010000",{{2,0,0,0},{2,4,0,0},{2,1,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Raphnet Technologies GC/N64 to USB v3.4","030000009b2800003200000001010000",{{2,0,0,0},{2,7,0,0},{2,1,0,0},{2,8,0,0},{0,0,0,0},{2,2,0,0},{0,0,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,10,0,0},{2,13,0,0},{2,11,0,0},{2,12,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Raphnet Technologies Dual NES to USB v2.0","030000009b2800004200000001010000",{{2,0,0,0},{2,1,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,2,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Raphnet Technologies GC/N64 to USB v3.6","030000009b2800006000000001010000",{{2,0,0,0},{2,7,0,0},{2,1,0,0},{2,8,0,0},{0,0,0,0},{2,2,0,0},{0,0,0,0},{2,3,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,10,0,0},{2,13,0,0},{2,11,0,0},{2,12,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Saitek P220","03000000a30600000701000000010000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,6,0,0},{2,4,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,7,0,0},{2,5,0,0}}},
+{"Saitek P880","03000000a30600000901000000010000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Saitek P990 Dual Analog Pad","03000000a30600000b04000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Saitek P2900 Wireless Pad","03000000a30600000c04000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,12,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"Saitek P2500 Force Rumble Pad","03000000a30600000cff000010010000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,11,0,0},{2,10,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Saitek P150","03000000a30600001005000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,7,0,0},{2,2,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,5,0,0}}},
+{"Saitek PLC Saitek P3200 Rumble Pad","03000000a306000018f5000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{2,7,0,0}}},
+{"Saitek PS2700 Rumble Pad","03000000a306000020f6000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Cyborg V.3 Rumble Pad","03000000a306000022f6000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{1,3,2,-1},{1,3,2,1}}},
+{"Saitek Cyborg V.1 Game Pad","03000000a306000023f6000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,4,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Astro City Mini","03000000a30c00002700000011010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{0,0,0,0},{2,4,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0}}},
+{"Astro City Mini","03000000a30c00002800000011010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{0,0,0,0},{2,4,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0}}},
+{"Xiaoji Gamesir-G3w","03000000ac0500005b05000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Hori Pad EX Turbo 2","03000000ad1b000001f5000033050000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Mad Catz Xbox 360 Controller","03000000ad1b000016f0000090040000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Mad Catz Fightpad SFxT","03000000ad1b00002ef0000090040000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,5,1,0}}},
+{"Street Fighter IV FightStick TE","03000000ad1b000038f0000090040000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"CYPRESS USB Gamepad","03000000b40400000a01000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,5,0,0},{2,8,0,0},{2,2,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Thrustmaster Firestorm Digital 2","03000000b50700000399000000010000",{{2,2,0,0},{2,4,0,0},{2,3,0,0},{2,5,0,0},{2,6,0,0},{2,8,0,0},{2,11,0,0},{2,1,0,0},{0,0,0,0},{2,10,0,0},{2,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,7,0,0},{2,9,0,0}}},
+{"impact","03000000b50700001503000010010000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,6,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,5,0,0},{2,7,0,0}}},
+{"Jess Technology USB Game Controller","03000000ba2200002010000001010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"ShanWan PS3/PC Wired GamePad","03000000bc2000000055000010010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"GameSir G3w","03000000bc2000000055000011010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Joypad Alpha Shock","03000000bd12000003c0000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Tomee SNES USB Controller","03000000bd12000015d0000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"PS4 Controller","03000000c01100000140000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{2,6,0,0},{2,7,0,0}}},
+{"ACRUX USB GAME PAD","03000000c01100000355000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Torid","03000000c01100000591000011010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"OnyxSoft Dual JoyDivision","03000000c0160000dc27000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{2,6,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Xin-Mo Xin-Mo Dual Arcade","03000000c0160000e105000001010000",{{2,4,0,0},{2,3,0,0},{2,1,0,0},{2,0,0,0},{2,2,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{2,11,0,0},{2,14,0,0},{2,12,0,0},{2,13,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Be1 GC101 Controller 1.03 mode","03000000c21100000791000011010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Be1 GC101 GAMEPAD 1.03 mode","03000000c31100000791000011010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"PowerA","03000000c62400000053000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Thrustmaster GPX Gamepad","03000000c6240000025b000002020000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Razer Sabertooth","03000000c6240000045d000024010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Razer Sabertooth","03000000c6240000045d000025010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Mini PE","03000000c62400001a53000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PowerA Xbox One Mini Wired Controller","03000000c62400001a54000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PowerA Xbox One Cabled","03000000c62400001a58000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"BDA MOGA XP5-X Plus","03000000c62400001b89000011010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"MOGA XP5-A Plus","03000000c62400002b89000011010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"PowerA 1428124-01","03000000c62400003a54000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"8BitDo Wireless Adapter (DInput)","03000000c82d00000031000011010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo FC30 Pro","03000000c82d00000090000011010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"8BitDo SN30 Pro","03000000c82d00000160000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30 Pro","03000000c82d00000160000011010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30 Pro","03000000c82d00000161000000000000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8Bitdo NES30 Pro 8Bitdo NES30 Pro","03000000c82d00000190000011010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,4,1,0},{1,5,1,0}}},
+{"8BitDo SN30 Pro+","03000000c82d00000260000011010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo NES30","03000000c82d00000310000011010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,7,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,8,0,0}}},
+{"8BitDo SN30 Pro","03000000c82d00001290000011010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo N30 Pro 2","03000000c82d00001590000011010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo Zero 2","03000000c82d00001890000011010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo SFC30","03000000c82d000021ab000010010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"HJC Game GAMEPAD","03000000c9110000f055000011010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Stadia Controller","03000000d11800000094000011010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"PowerA Wired Controller for Xbox One","03000000d62000000228000001010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Mayflash Magic NS","03000000d620000010a7000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"BDA PS4 Fightpad","03000000d62000002a79000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PowerA Pro Ex","03000000d62000006dca000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"IMS PCU#0 Gamepad Interface","03000000d80400008200000003000000",{{2,1,0,0},{2,0,0,0},{2,3,0,0},{2,2,0,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Toodles 2008 Chimp PC/PS3","03000000d814000007cd000011010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"HitBox (PS3/PC) Analog Mode","03000000d81400000862000011010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,12,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,7,0,0}}},
+{"Savior","03000000d81d00000e00000010010000",{{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,2,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,7,0,0},{2,3,0,0}}},
+{"Steam Controller","03000000de2800000112000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,3,1,0}}},
+{"Steam Controller","03000000de2800000211000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,3,1,0}}},
+{"Steam Controller","03000000de2800000211000011010000",{{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{0,0,0,0},{2,17,0,0},{2,20,0,0},{2,18,0,0},{2,19,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Steam Controller","03000000de2800004211000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,3,1,0}}},
+{"Steam Controller","03000000de2800004211000011010000",{{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{0,0,0,0},{2,17,0,0},{2,20,0,0},{2,18,0,0},{2,19,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Steam Controller","03000000de280000fc11000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Steam Virtual Gamepad","03000000de280000ff11000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Cideko AK08b","03000000e82000006058000001010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"AxisPad","03000000ef0500000300000000010000",{{2,2,0,0},{2,3,0,0},{2,0,0,0},{2,1,0,0},{2,4,0,0},{2,5,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,6,0,0},{2,7,0,0}}},
+{"ShanWan Gioteck PS3 Wired Controller","03000000f025000021c1000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Goodbetterbest Ltd USB Controller","03000000f0250000c183000010010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"GT VX2","03000000f0250000c383000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"InterAct GoPad I-73000 (Fighting Game Layout)","03000000fd0500000030000000010000",{{2,3,0,0},{2,4,0,0},{2,0,0,0},{2,1,0,0},{0,0,0,0},{2,2,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,5,0,0}}},
+{"PSP","03000000ff000000cb01000010010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"PC Game Controller","03000000ff1100003133000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PS2 Controller","03000000ff1100004133000010010000",{{2,2,0,0},{2,1,0,0},{2,3,0,0},{2,0,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,4,0,0},{2,5,0,0}}},
+{"Chinese-made Xbox Controller","03000000ffff0000ffff000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,2,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Nintendo Wiimote","05000000010000000100000003000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"ASUS Gamepad","05000000050b00000045000031000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"ASUS Gamepad","05000000050b00000045000040000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,10,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Wireless HORIPAD Switch Pro Controller","050000000d0f0000f600000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"8Bitdo SFC30 GamePad","05000000102800000900000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"SteelSeries Stratus XL","05000000110100001914000009010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"SteelSeries Stratus Duo","0500000011010000311400001b010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,32,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"XiaoMi Game Controller","05000000172700004431000029010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,20,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,7,1,0},{1,6,1,0}}},
+{"8BitDo SNES30 Gamepad","05000000202800000900000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,117,0,0},{2,120,0,0},{2,122,0,0},{2,119,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8Bitdo NES30 Pro","05000000203800000900000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Razer Serval","050000003215000000090000163a0000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"OUYA Game Controller","05000000362800000100000002010000",{{2,0,0,0},{2,3,0,0},{2,1,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{0,0,0,0},{2,14,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,11,0,0},{2,9,0,0},{2,10,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"OUYA Game Controller","05000000362800000100000003010000",{{2,0,0,0},{2,3,0,0},{2,1,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{0,0,0,0},{2,14,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,11,0,0},{2,9,0,0},{2,10,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"Mad Catz C.T.R.L.R ","05000000380700006652000025010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"GameStop Gamepad","0500000047532047616d657061640000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"GS gamepad","0500000047532067616d657061640000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{2,9,0,0},{2,8,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"PG-9118","05000000491900000204000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Ipega PG-9069 - Bluetooth Gamepad","0500000049190000020400001b010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,161,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Amazon Fire Game Controller","05000000491900000204000021000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,17,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"PG-9099","0500000049190000030400001b010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"PS3 Controller","050000004c0500006802000000000000",{{2,14,0,0},{2,13,0,0},{2,15,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{2,0,0,0},{2,3,0,0},{2,16,0,0},{2,1,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"PS3 Controller","050000004c0500006802000000010000",{{2,14,0,0},{2,13,0,0},{2,15,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{2,0,0,0},{2,3,0,0},{2,16,0,0},{2,1,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,12,1,0},{1,13,1,0}}},
+{"PS3 Controller","050000004c0500006802000000800000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,16,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS3 Controller","050000004c0500006802000000810000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,16,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS4 Controller","050000004c050000c405000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","050000004c050000c405000000810000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS4 Controller","050000004c050000c405000001800000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS4 Controller","050000004c050000cc09000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"PS4 Controller","050000004c050000cc09000000810000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS4 Controller","050000004c050000cc09000001800000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS5 Controller","050000004c050000e60c000000010000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Sony DualSense ","050000004c050000e60c000000810000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"M54-PC","050000004d4f435554452d3035305800",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Atari Classic Controller","05000000503200000110000000000000",{{2,0,0,0},{0,0,0,0},{2,1,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Atari Game Controller","05000000503200000210000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"PS3 Controller","05000000504c415953544154494f4e00",{{2,14,0,0},{2,13,0,0},{2,15,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{2,0,0,0},{2,3,0,0},{2,16,0,0},{2,1,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"NVIDIA Controller v01.04","05000000550900001472000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,14,0,0},{2,6,0,0},{2,16,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,5,1,0},{1,3,1,0},{1,4,1,0}}},
+{"Xbox One Elite Series 2","050000005e040000050b000002090000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,136,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,6,1,0},{1,5,1,0}}},
+{"Microsoft X-Box One Elite 2 pad","050000005e040000050b000003090000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,17,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,6,1,0},{1,5,1,0}}},
+{"Xbox Series Controller","050000005e040000130b000001050000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Xbox Series Controller","050000005e040000130b000005050000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Xbox One Wireless Controller","050000005e040000e002000003090000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,8,0,0},{2,9,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"8BitDo Zero 2 (XInput)","050000005e040000e002000030110000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Xbox One Wireless Controller","050000005e040000fd02000003090000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,15,0,0},{2,11,0,0},{2,16,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Xbox One Controller","050000005e040000fd02000030110000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"idroid:con","050000006964726f69643a636f6e0000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Amazon Luna Controller","05000000710100001904000000010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,6,0,0},{2,10,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Nintendo Switch Left Joy-Con","050000007e0500000620000001800000",{{2,9,0,0},{2,8,0,0},{2,7,0,0},{2,10,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,0,0,0},{0,0,0,0},{2,6,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,1,1,0},{1,0,-1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Nintendo Switch Right Joy-Con","050000007e0500000720000001800000",{{2,1,0,0},{2,2,0,0},{2,0,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,9,0,0},{2,8,0,0},{0,0,0,0},{2,10,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,1,-1,0},{1,0,-1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Nintendo Switch Pro Controller","050000007e0500000920000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"Nintendo Switch Pro Controller","050000007e0500000920000001800000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,5,0,0},{2,6,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,7,0,0},{2,8,0,0}}},
+{"Nintendo Switch SNES Controller","050000007e0500001720000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"Nintendo Wii Remote Pro Controller","050000007e0500003003000001000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,16,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,6,0,0},{2,7,0,0}}},
+{"8Bitdo Zero GamePad","05000000a00500003232000001000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8Bitdo Zero GamePad","05000000a00500003232000008010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{1,1,2,1},{1,0,2,-1},{1,1,2,-1},{1,0,2,1}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"VR-BOX","05000000ac0500003232000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,10,0,0},{2,11,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,2,1,0},{2,4,0,0},{2,5,0,0}}},
+{"BETOP AX1 BFM","05000000bc2000000055000001000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"MOGA XP5-X Plus","05000000c62400001a89000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"MOGA XP5-A Plus","05000000c62400002a89000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,22,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"8BitDo SF30 Pro","05000000c82d00000060000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8Bitdo SF30 Pro","05000000c82d00000061000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"8BitDo SN30 Pro","05000000c82d00000161000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo SN30 Pro+","05000000c82d00000261000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8Bitdo FC30 Pro","05000000c82d00001038000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8Bitdo NES30 Pro","05000000c82d00002038000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{2,2,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"8Bitdo SFC30 GamePad","05000000c82d00003028000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo Zero 2","05000000c82d00003032000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{0,0,0,0},{0,0,0,0}}},
+{"8BitDo M30","05000000c82d00005106000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,8,0,0},{2,6,0,0},{0,0,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,9,0,0},{2,7,0,0}}},
+{"8BitDo SN30 Pro","05000000c82d00006228000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo N30 Pro 2","05000000c82d00006528000000010000",{{2,1,0,0},{2,0,0,0},{2,4,0,0},{2,3,0,0},{2,6,0,0},{2,7,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{2,13,0,0},{2,14,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"8BitDo NES30","05000000c82d00008010000000010000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,4,0,0},{2,7,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{0,0,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,6,0,0},{2,8,0,0}}},
+{"Moga Pro 2 HID","05000000d62000007162000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,6,0,0},{0,0,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Moga Pro","05000000d6200000ad0d000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{2,6,0,0},{0,0,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Moga 2 HID","05000000d6200000e589000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,9,0,0},{2,6,0,0},{0,0,0,0},{2,7,0,0},{2,8,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{1,5,1,0},{1,4,1,0}}},
+{"Steam Controller","05000000de2800000212000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,3,1,0}}},
+{"Steam Controller","05000000de2800000511000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,3,1,0}}},
+{"Steam Controller","05000000de2800000611000001000000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,15,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{1,2,1,0},{1,3,1,0}}},
+{"PS3 Controller","060000004c0500006802000000010000",{{2,14,0,0},{2,13,0,0},{2,15,0,0},{2,12,0,0},{2,10,0,0},{2,11,0,0},{2,0,0,0},{2,3,0,0},{2,16,0,0},{2,1,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,8,0,0},{2,9,0,0}}},
+{"Nintendo Combined Joy-Cons (joycond)","060000007e0500000820000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,5,0,0},{2,6,0,0},{2,9,0,0},{2,10,0,0},{2,11,0,0},{2,12,0,0},{2,13,0,0},{2,14,0,0},{2,17,0,0},{2,15,0,0},{2,16,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{2,7,0,0},{2,8,0,0}}},
+{"Nintendo 3DS","060000007e0500003713000000000000",{{2,0,0,0},{2,1,0,0},{2,3,0,0},{2,2,0,0},{2,4,0,0},{2,5,0,0},{2,8,0,0},{2,9,0,0},{0,0,0,0},{0,0,0,0},{0,0,0,0},{2,10,0,0},{2,13,0,0},{2,11,0,0},{2,12,0,0}},{{1,0,1,0},{1,1,1,0},{1,2,1,0},{1,3,1,0},{0,0,0,0},{0,0,0,0}}},
+{"Hidromancer Game Controller","06000000adde0000efbe000002010000",{{2,0,0,0},{2,1,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{2,6,0,0},{2,7,0,0},{2,8,0,0},{2,9,0,0},{2,10,0,0},{3,1,0,0},{3,2,0,0},{3,4,0,0},{3,8,0,0}},{{1,0,1,0},{1,1,1,0},{1,3,1,0},{1,4,1,0},{1,2,1,0},{1,5,1,0}}},
+{"odroidgo2_joypad","19000000010000000100000001010000",{{2,1,0,0},{2,0,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{2,15,0,0},{2,10,0,0},{2,12,0,0},{2,13,0,0},{2,6,0,0},{2,9,0,0},{2,7,0,0},{2,8,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,11,0,0},{2,14,0,0}}},
+{"odroidgo2_joypad_v11","19000000010000000200000011000000",{{2,1,0,0},{2,0,0,0},{2,2,0,0},{2,3,0,0},{2,4,0,0},{2,5,0,0},{0,0,0,0},{2,17,0,0},{2,12,0,0},{2,14,0,0},{2,15,0,0},{2,8,0,0},{2,11,0,0},{2,9,0,0},{2,10,0,0}},{{1,0,1,0},{1,1,1,0},{0,0,0,0},{0,0,0,0},{2,13,0,0},{2,16,0,0}}},
+#endif // GLFW_BUILD_LINUX_JOYSTICK
+};
+
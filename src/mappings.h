@@ -31,7 +31,8 @@
 // all available in SDL_GameControllerDB.  Do not edit this file.  Any gamepad
 // mappings not specific to GLFW should be submitted to SDL_GameControllerDB.
 // This file can be re-generated from mappings.h.in and the upstream
-// gamecontrollerdb.txt with the 'update_mappings' CMake target.
+// gamecontrollerdb.txt with the 'update_mappings' CMake target, which also
+// re-generates the pre-parsed mapping_table.h used by GLFW.
 //========================================================================
 
 // All gamepad mappings not labeled GLFW are copied from the
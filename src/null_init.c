@@ -49,6 +49,7 @@ GLFWbool _glfwConnectNull(int platformID, _GLFWplatform* platform)
         _glfwSetRawMouseMotionNull,
         _glfwRawMouseMotionSupportedNull,
         _glfwCreateCursorNull,
+        _glfwCreateAnimatedCursorNull,
         _glfwCreateStandardCursorNull,
         _glfwDestroyCursorNull,
         _glfwSetCursorNull,
@@ -105,6 +106,7 @@ GLFWbool _glfwConnectNull(int platformID, _GLFWplatform* platform)
         _glfwPollEventsNull,
         _glfwWaitEventsNull,
         _glfwWaitEventsTimeoutNull,
+        _glfwWaitEventsUntilNull,
         _glfwPostEmptyEventNull,
         _glfwGetEGLPlatformNull,
         _glfwGetEGLNativeDisplayNull,
@@ -497,6 +497,13 @@ void _glfwWaitEventsTimeoutNull(double timeout)
 {
 }
 
+// NOTE: This returns immediately like the other wait functions, so frame pacing
+//       busy-waits for the whole period on this platform
+//
+void _glfwWaitEventsUntilNull(uint64_t timerValue)
+{
+}
+
 void _glfwPostEmptyEventNull(void)
 {
 }
@@ -526,6 +533,15 @@ GLFWbool _glfwCreateCursorNull(_GLFWcursor* cursor,
     return GLFW_TRUE;
 }
 
+GLFWbool _glfwCreateAnimatedCursorNull(_GLFWcursor* cursor,
+                                       const GLFWimage* images,
+                                       int count,
+                                       const double* delays,
+                                       int xhot, int yhot)
+{
+    return GLFW_TRUE;
+}
+
 GLFWbool _glfwCreateStandardCursorNull(_GLFWcursor* cursor, int shape)
 {
     return GLFW_TRUE;
@@ -0,0 +1,265 @@
+//========================================================================
+// GLFW 3.4 X11/Wayland - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2022 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+// It is fine to use C99 in this file because it will not be built with VS
+//========================================================================
+
+#include "internal.h"
+
+#if defined(__SSE2__)
+ #define GLFW_PIXELS_SSE2
+ #include <emmintrin.h>
+ #if defined(__AVX2__)
+  #define GLFW_PIXELS_AVX2
+  #define GLFW_PIXELS_AVX2_TARGET
+  #include <immintrin.h>
+ #elif defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+  // AVX2 is not part of the baseline so its kernel is selected at run-time
+  #define GLFW_PIXELS_AVX2
+  #define GLFW_PIXELS_AVX2_DISPATCH
+  #define GLFW_PIXELS_AVX2_TARGET __attribute__((target("avx2")))
+  #include <immintrin.h>
+ #endif
+#elif defined(__ARM_NEON) && \
+      defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+ #define GLFW_PIXELS_NEON
+ #include <arm_neon.h>
+#endif
+
+// All kernels compute c * a / 255 with truncation, exactly as the scalar
+// division would, using (x + 1 + (x >> 8)) >> 8.  This is exact for every
+// product of two 8-bit values and never overflows a 16-bit lane.
+//
+// The SIMD kernels convert as many whole vectors as fit and return the number
+// of pixels they handled, leaving the remainder to the scalar kernel.
+
+static uint32_t div255(uint32_t x)
+{
+    return (x + 1 + (x >> 8)) >> 8;
+}
+
+static void convertScalar(uint32_t* target,
+                          const unsigned char* source,
+                          size_t count,
+                          GLFWbool premultiply)
+{
+    for (size_t i = 0;  i < count;  i++, source += 4)
+    {
+        const uint32_t alpha = source[3];
+
+        if (premultiply)
+        {
+            target[i] = (alpha << 24) |
+                        (div255(source[0] * alpha) << 16) |
+                        (div255(source[1] * alpha) <<  8) |
+                        (div255(source[2] * alpha) <<  0);
+        }
+        else
+        {
+            target[i] = (alpha << 24) |
+                        ((uint32_t) source[0] << 16) |
+                        ((uint32_t) source[1] <<  8) |
+                        ((uint32_t) source[2] <<  0);
+        }
+    }
+}
+
+#if defined(GLFW_PIXELS_SSE2)
+
+// Multiplies the color channels of two pixels widened to 16-bit lanes by their
+// alpha; the alpha lanes end up garbage and must be masked back in
+static __m128i premultiplySSE2(__m128i pixels)
+{
+    __m128i alpha = _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+
+    const __m128i x = _mm_mullo_epi16(pixels, alpha);
+    const __m128i y = _mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)),
+                                    _mm_srli_epi16(x, 8));
+    return _mm_srli_epi16(y, 8);
+}
+
+static size_t convertSSE2(uint32_t* target,
+                          const unsigned char* source,
+                          size_t count,
+                          GLFWbool premultiply)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32((int) 0xff000000);
+    const __m128i greenAlphaMask = _mm_set1_epi32((int) 0xff00ff00);
+    const __m128i lowMask = _mm_set1_epi32(0xff);
+    size_t i;
+
+    for (i = 0;  i + 4 <= count;  i += 4)
+    {
+        __m128i pixels = _mm_loadu_si128((const __m128i*) (source + i * 4));
+
+        if (premultiply)
+        {
+            const __m128i lo = premultiplySSE2(_mm_unpacklo_epi8(pixels, zero));
+            const __m128i hi = premultiplySSE2(_mm_unpackhi_epi8(pixels, zero));
+            pixels = _mm_or_si128(_mm_andnot_si128(alphaMask, _mm_packus_epi16(lo, hi)),
+                                  _mm_and_si128(pixels, alphaMask));
+        }
+
+        // Swap the red and blue bytes of each pixel
+        pixels = _mm_or_si128(_mm_and_si128(pixels, greenAlphaMask),
+                              _mm_or_si128(_mm_slli_epi32(_mm_and_si128(pixels, lowMask), 16),
+                                           _mm_and_si128(_mm_srli_epi32(pixels, 16), lowMask)));
+
+        _mm_storeu_si128((__m128i*) (target + i), pixels);
+    }
+
+    return i;
+}
+
+#endif // GLFW_PIXELS_SSE2
+
+#if defined(GLFW_PIXELS_AVX2)
+
+GLFW_PIXELS_AVX2_TARGET
+static __m256i premultiplyAVX2(__m256i pixels)
+{
+    __m256i alpha = _mm256_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm256_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+
+    const __m256i x = _mm256_mullo_epi16(pixels, alpha);
+    const __m256i y = _mm256_add_epi16(_mm256_add_epi16(x, _mm256_set1_epi16(1)),
+                                       _mm256_srli_epi16(x, 8));
+    return _mm256_srli_epi16(y, 8);
+}
+
+GLFW_PIXELS_AVX2_TARGET
+static size_t convertAVX2(uint32_t* target,
+                          const unsigned char* source,
+                          size_t count,
+                          GLFWbool premultiply)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i alphaMask = _mm256_set1_epi32((int) 0xff000000);
+    const __m256i redBlueShuffle =
+        _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                         2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    size_t i;
+
+    for (i = 0;  i + 8 <= count;  i += 8)
+    {
+        __m256i pixels = _mm256_loadu_si256((const __m256i*) (source + i * 4));
+
+        if (premultiply)
+        {
+            // The unpack and pack instructions both work within 128-bit lanes,
+            // so the pixels end up back in their original order
+            const __m256i lo = premultiplyAVX2(_mm256_unpacklo_epi8(pixels, zero));
+            const __m256i hi = premultiplyAVX2(_mm256_unpackhi_epi8(pixels, zero));
+            pixels = _mm256_or_si256(_mm256_andnot_si256(alphaMask, _mm256_packus_epi16(lo, hi)),
+                                     _mm256_and_si256(pixels, alphaMask));
+        }
+
+        pixels = _mm256_shuffle_epi8(pixels, redBlueShuffle);
+        _mm256_storeu_si256((__m256i*) (target + i), pixels);
+    }
+
+    return i;
+}
+
+#endif // GLFW_PIXELS_AVX2
+
+#if defined(GLFW_PIXELS_NEON)
+
+static uint8x16_t premultiplyNEON(uint8x16_t color, uint8x16_t alpha)
+{
+    const uint16x8_t one = vdupq_n_u16(1);
+    const uint16x8_t lo = vmull_u8(vget_low_u8(color), vget_low_u8(alpha));
+    const uint16x8_t hi = vmull_u8(vget_high_u8(color), vget_high_u8(alpha));
+
+    return vcombine_u8(vshrn_n_u16(vaddq_u16(vaddq_u16(lo, one), vshrq_n_u16(lo, 8)), 8),
+                       vshrn_n_u16(vaddq_u16(vaddq_u16(hi, one), vshrq_n_u16(hi, 8)), 8));
+}
+
+static size_t convertNEON(uint32_t* target,
+                          const unsigned char* source,
+                          size_t count,
+                          GLFWbool premultiply)
+{
+    size_t i;
+
+    for (i = 0;  i + 16 <= count;  i += 16)
+    {
+        // Loading deinterleaves the channels into red, green, blue and alpha
+        const uint8x16x4_t pixels = vld4q_u8(source + i * 4);
+        uint8x16x4_t result;
+
+        if (premultiply)
+        {
+            result.val[0] = premultiplyNEON(pixels.val[2], pixels.val[3]);
+            result.val[1] = premultiplyNEON(pixels.val[1], pixels.val[3]);
+            result.val[2] = premultiplyNEON(pixels.val[0], pixels.val[3]);
+        }
+        else
+        {
+            result.val[0] = pixels.val[2];
+            result.val[1] = pixels.val[1];
+            result.val[2] = pixels.val[0];
+        }
+
+        result.val[3] = pixels.val[3];
+
+        // Little-endian ARGB is stored as blue, green, red, alpha
+        vst4q_u8((uint8_t*) (target + i), result);
+    }
+
+    return i;
+}
+
+#endif // GLFW_PIXELS_NEON
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+void _glfwConvertPixelsARGB(uint32_t* target,
+                            const unsigned char* source,
+                            size_t count,
+                            GLFWbool premultiply)
+{
+    size_t done = 0;
+
+#if defined(GLFW_PIXELS_AVX2_DISPATCH)
+    if (__builtin_cpu_supports("avx2"))
+        done = convertAVX2(target, source, count, premultiply);
+#elif defined(GLFW_PIXELS_AVX2)
+    done = convertAVX2(target, source, count, premultiply);
+#endif
+
+#if defined(GLFW_PIXELS_SSE2)
+    done += convertSSE2(target + done, source + done * 4, count - done, premultiply);
+#elif defined(GLFW_PIXELS_NEON)
+    done = convertNEON(target, source, count, premultiply);
+#endif
+
+    convertScalar(target + done, source + done * 4, count - done, premultiply);
+}
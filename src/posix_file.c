@@ -0,0 +1,100 @@
+//========================================================================
+// GLFW 3.4 POSIX - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2021 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+// It is fine to use C99 in this file because it will not be built with VS
+//========================================================================
+
+#include "internal.h"
+
+#if defined(GLFW_BUILD_POSIX_FILE)
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW platform API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+GLFWbool _glfwPlatformMapFile(const char* path, void** data, size_t* size)
+{
+    struct stat sb;
+
+    *data = NULL;
+    *size = 0;
+
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to open file %s: %s",
+                        path, strerror(errno));
+        return GLFW_FALSE;
+    }
+
+    if (fstat(fd, &sb) == -1)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to query size of file %s: %s",
+                        path, strerror(errno));
+        close(fd);
+        return GLFW_FALSE;
+    }
+
+    // Empty files cannot be mapped but are not an error
+    if (sb.st_size == 0)
+    {
+        close(fd);
+        return GLFW_TRUE;
+    }
+
+    void* mapping = mmap(NULL, (size_t) sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to map file %s: %s",
+                        path, strerror(errno));
+        return GLFW_FALSE;
+    }
+
+    *data = mapping;
+    *size = (size_t) sb.st_size;
+    return GLFW_TRUE;
+}
+
+void _glfwPlatformUnmapFile(void* data, size_t size)
+{
+    if (data)
+        munmap(data, size);
+}
+
+#endif // GLFW_BUILD_POSIX_FILE
+
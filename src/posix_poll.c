@@ -35,39 +35,162 @@
 #include <signal.h>
 #include <time.h>
 #include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <unistd.h>
 
-GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
+#if defined(__linux__)
+ #include <sys/timerfd.h>
+#endif
+
+// The largest number of file descriptors that can be polled together with the
+// deadline timer
+#define _GLFW_POLL_TIMERFD_MAX_COUNT 15
+
+// Converts a timer value or interval to a timespec
+//
+static struct timespec timerValueToTimespec(uint64_t value)
+{
+    const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+    struct timespec ts;
+    ts.tv_sec = (time_t) (value / frequency);
+    ts.tv_nsec = (long) ((value % frequency) * 1000000000 / frequency);
+    return ts;
+}
+
+#if defined(__linux__)
+
+// Waits for any of the specified file descriptors or the deadline timer,
+// which must already be armed
+//
+static GLFWbool pollWithTimerfd(struct pollfd* fds, nfds_t count)
+{
+    struct pollfd all[_GLFW_POLL_TIMERFD_MAX_COUNT + 1];
+
+    memcpy(all, fds, count * sizeof(struct pollfd));
+    all[count] = (struct pollfd) { _glfw.posixPoll.timerfd, POLLIN };
+
+    for (;;)
+    {
+        const int result = poll(all, count + 1, -1);
+        if (result > 0)
+        {
+            GLFWbool ready = GLFW_FALSE;
+
+            for (nfds_t i = 0; i < count; i++)
+            {
+                fds[i].revents = all[i].revents;
+                if (fds[i].revents)
+                    ready = GLFW_TRUE;
+            }
+
+            if (all[count].revents & POLLIN)
+            {
+                uint64_t expirations;
+                while (read(_glfw.posixPoll.timerfd, &expirations,
+                            sizeof(expirations)) == -1 && errno == EINTR)
+                    ;
+            }
+
+            return ready;
+        }
+        else if (result == -1 && errno != EINTR && errno != EAGAIN)
+            return GLFW_FALSE;
+    }
+}
+
+// Returns the deadline timer, creating it on first use
+// NOTE: This cannot be done by _glfwInitPollPOSIX as that is called during
+//       platform initialization, before the timer has chosen its clock
+//
+static int getTimerfd(void)
+{
+    if (!_glfw.posixPoll.timerfdCreated)
+    {
+        _glfw.posixPoll.timerfd = timerfd_create(_glfw.timer.posix.clock,
+                                                 TFD_CLOEXEC | TFD_NONBLOCK);
+        _glfw.posixPoll.timerfdCreated = GLFW_TRUE;
+    }
+
+    return _glfw.posixPoll.timerfd;
+}
+
+#endif // __linux__
+
+void _glfwInitPollPOSIX(void)
+{
+    _glfw.posixPoll.timerfd = -1;
+    _glfw.posixPoll.timerfdCreated = GLFW_FALSE;
+}
+
+void _glfwTerminatePollPOSIX(void)
+{
+    if (_glfw.posixPoll.timerfd >= 0)
+        close(_glfw.posixPoll.timerfd);
+
+    _glfw.posixPoll.timerfd = -1;
+    _glfw.posixPoll.timerfdCreated = GLFW_FALSE;
+}
+
+uint64_t _glfwTimeoutToDeadlinePOSIX(double timeout)
+{
+    const uint64_t base = _glfwPlatformGetTimerValue();
+    const double ticks = timeout * _glfwPlatformGetTimerFrequency();
+
+    if (ticks >= (double) (UINT64_MAX - base))
+        return UINT64_MAX;
+
+    return base + (uint64_t) ticks;
+}
+
+GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, const uint64_t* deadline)
 {
     for (;;)
     {
-        if (timeout)
+        if (deadline)
         {
             const uint64_t base = _glfwPlatformGetTimerValue();
+            const uint64_t remaining = *deadline > base ? *deadline - base : 0;
+
+#if defined(__linux__)
+            // NOTE: An absolute timer is not affected by any delay between
+            //       reading the time above and the thread entering the poll
+            if (remaining > 0 &&
+                count <= _GLFW_POLL_TIMERFD_MAX_COUNT &&
+                getTimerfd() >= 0)
+            {
+                const struct itimerspec its =
+                {
+                    { 0, 0 }, timerValueToTimespec(*deadline)
+                };
+
+                if (timerfd_settime(_glfw.posixPoll.timerfd,
+                                    TFD_TIMER_ABSTIME, &its, NULL) == 0)
+                {
+                    return pollWithTimerfd(fds, count);
+                }
+            }
+#endif
 
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__CYGWIN__)
-            const time_t seconds = (time_t) *timeout;
-            const long nanoseconds = (long) ((*timeout - seconds) * 1e9);
-            const struct timespec ts = { seconds, nanoseconds };
+            const struct timespec ts = timerValueToTimespec(remaining);
             const int result = ppoll(fds, count, &ts, NULL);
 #elif defined(__NetBSD__)
-            const time_t seconds = (time_t) *timeout;
-            const long nanoseconds = (long) ((*timeout - seconds) * 1e9);
-            const struct timespec ts = { seconds, nanoseconds };
+            const struct timespec ts = timerValueToTimespec(remaining);
             const int result = pollts(fds, count, &ts, NULL);
 #else
-            const int milliseconds = (int) (*timeout * 1e3);
-            const int result = poll(fds, count, milliseconds);
+            const uint64_t milliseconds =
+                remaining / (_glfwPlatformGetTimerFrequency() / 1000);
+            const int result = poll(fds, count,
+                                    milliseconds < INT_MAX ? (int) milliseconds : INT_MAX);
 #endif
             const int error = errno; // clock_gettime may overwrite our error
 
-            *timeout -= (_glfwPlatformGetTimerValue() - base) /
-                (double) _glfwPlatformGetTimerFrequency();
-
             if (result > 0)
                 return GLFW_TRUE;
             else if (result == -1 && error != EINTR && error != EAGAIN)
                 return GLFW_FALSE;
-            else if (*timeout <= 0.0)
+            else if (_glfwPlatformGetTimerValue() >= *deadline)
                 return GLFW_FALSE;
         }
         else
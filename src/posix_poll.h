@@ -28,5 +28,21 @@
 
 #include <poll.h>
 
-GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout);
+#define GLFW_POSIX_LIBRARY_POLL_STATE _GLFWpollPOSIX posixPoll;
+
+// POSIX-specific global poll data
+//
+typedef struct _GLFWpollPOSIX
+{
+    // Absolute deadline timer, or -1 if not available
+    int             timerfd;
+    // Whether creation of the deadline timer has been attempted
+    GLFWbool        timerfdCreated;
+} _GLFWpollPOSIX;
+
+
+void _glfwInitPollPOSIX(void);
+void _glfwTerminatePollPOSIX(void);
+uint64_t _glfwTimeoutToDeadlinePOSIX(double timeout);
+GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, const uint64_t* deadline);
 
@@ -105,5 +105,19 @@ void _glfwPlatformUnlockMutex(_GLFWmutex* mutex)
     pthread_mutex_unlock(&mutex->posix.handle);
 }
 
+void* _glfwPlatformExchangePointer(void* volatile* target, void* value)
+{
+    return __atomic_exchange_n(target, value, __ATOMIC_ACQ_REL);
+}
+
+void* _glfwPlatformCompareExchangePointer(void* volatile* target,
+                                          void* expected,
+                                          void* desired)
+{
+    __atomic_compare_exchange_n(target, &expected, desired, GLFW_FALSE,
+                                __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    return expected;
+}
+
 #endif // GLFW_BUILD_POSIX_THREAD
 
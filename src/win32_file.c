@@ -0,0 +1,113 @@
+//========================================================================
+// GLFW 3.4 Win32 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2021 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+// Please use C89 style variable declarations in this file because VS 2010
+//========================================================================
+
+#include "internal.h"
+
+#if defined(GLFW_BUILD_WIN32_FILE)
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW platform API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+GLFWbool _glfwPlatformMapFile(const char* path, void** data, size_t* size)
+{
+    HANDLE file, mapping;
+    LARGE_INTEGER fileSize;
+    WCHAR* widePath;
+    int count;
+
+    *data = NULL;
+    *size = 0;
+
+    count = MultiByteToWideChar(CP_UTF8, 0, path, -1, NULL, 0);
+    if (!count)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Win32: Failed to convert path %s to wide string", path);
+        return GLFW_FALSE;
+    }
+
+    widePath = _glfw_calloc(count, sizeof(WCHAR));
+    MultiByteToWideChar(CP_UTF8, 0, path, -1, widePath, count);
+
+    file = CreateFileW(widePath, GENERIC_READ, FILE_SHARE_READ, NULL,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    _glfw_free(widePath);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR, "Win32: Failed to open file %s", path);
+        return GLFW_FALSE;
+    }
+
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Win32: Failed to query size of file %s", path);
+        CloseHandle(file);
+        return GLFW_FALSE;
+    }
+
+    // Empty files cannot be mapped but are not an error
+    if (fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return GLFW_TRUE;
+    }
+
+    mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+
+    if (!mapping)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR, "Win32: Failed to map file %s", path);
+        return GLFW_FALSE;
+    }
+
+    *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+
+    if (!*data)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR, "Win32: Failed to map file %s", path);
+        return GLFW_FALSE;
+    }
+
+    *size = (size_t) fileSize.QuadPart;
+    return GLFW_TRUE;
+}
+
+void _glfwPlatformUnmapFile(void* data, size_t size)
+{
+    if (data)
+        UnmapViewOfFile(data);
+}
+
+#endif // GLFW_BUILD_WIN32_FILE
+
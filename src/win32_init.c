@@ -614,6 +614,7 @@ GLFWbool _glfwConnectWin32(int platformID, _GLFWplatform* platform)
         _glfwSetRawMouseMotionWin32,
         _glfwRawMouseMotionSupportedWin32,
         _glfwCreateCursorWin32,
+        _glfwCreateAnimatedCursorWin32,
         _glfwCreateStandardCursorWin32,
         _glfwDestroyCursorWin32,
         _glfwSetCursorWin32,
@@ -670,6 +671,7 @@ GLFWbool _glfwConnectWin32(int platformID, _GLFWplatform* platform)
         _glfwPollEventsWin32,
         _glfwWaitEventsWin32,
         _glfwWaitEventsTimeoutWin32,
+        _glfwWaitEventsUntilWin32,
         _glfwPostEmptyEventWin32,
         _glfwGetEGLPlatformWin32,
         _glfwGetEGLNativeDisplayWin32,
@@ -98,5 +98,17 @@ void _glfwPlatformUnlockMutex(_GLFWmutex* mutex)
     LeaveCriticalSection(&mutex->win32.section);
 }
 
+void* _glfwPlatformExchangePointer(void* volatile* target, void* value)
+{
+    return InterlockedExchangePointer(target, value);
+}
+
+void* _glfwPlatformCompareExchangePointer(void* volatile* target,
+                                          void* expected,
+                                          void* desired)
+{
+    return InterlockedCompareExchangePointer(target, desired, expected);
+}
+
 #endif // GLFW_BUILD_WIN32_THREAD
 
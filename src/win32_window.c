@@ -2053,11 +2053,16 @@ void _glfwPollEventsWin32(void)
         }
         else
         {
+            // Message times are GetTickCount milliseconds
+            _glfwInputEventTime(_glfwMillisecondsToTimerValue(msg.time));
+
             TranslateMessage(&msg);
             DispatchMessageW(&msg);
         }
     }
 
+    _glfwInputEventTime(0);
+
     // HACK: Release modifier keys that the system did not emit KEYUP for
     // NOTE: Shift keys on Windows tend to "stick" when both are pressed as
     //       no key up message is generated by the first key release
@@ -2126,6 +2131,23 @@ void _glfwWaitEventsTimeoutWin32(double timeout)
     _glfwPollEventsWin32();
 }
 
+void _glfwWaitEventsUntilWin32(uint64_t timerValue)
+{
+    const uint64_t base = _glfwPlatformGetTimerValue();
+
+    if (timerValue > base)
+    {
+        // Round up so that the wait does not end before the deadline
+        const uint64_t ticksPerMS = _glfwPlatformGetTimerFrequency() / 1000;
+        const uint64_t milliseconds = (timerValue - base + ticksPerMS - 1) / ticksPerMS;
+        const DWORD wait = milliseconds < INFINITE ? (DWORD) milliseconds : INFINITE - 1;
+
+        MsgWaitForMultipleObjects(0, NULL, FALSE, wait, QS_ALLEVENTS);
+    }
+
+    _glfwPollEventsWin32();
+}
+
 void _glfwPostEmptyEventWin32(void)
 {
     PostMessageW(_glfw.win32.helperWindowHandle, WM_NULL, 0, 0);
@@ -2225,6 +2247,17 @@ GLFWbool _glfwCreateCursorWin32(_GLFWcursor* cursor,
     return GLFW_TRUE;
 }
 
+GLFWbool _glfwCreateAnimatedCursorWin32(_GLFWcursor* cursor,
+                                        const GLFWimage* images,
+                                        int count,
+                                        const double* delays,
+                                        int xhot, int yhot)
+{
+    // NOTE: Animated cursors can only be loaded from ANI files or resources,
+    //       so only the first frame is used
+    return _glfwCreateCursorWin32(cursor, images, xhot, yhot);
+}
+
 GLFWbool _glfwCreateStandardCursorWin32(_GLFWcursor* cursor, int shape)
 {
     int id = 0;
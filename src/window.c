@@ -36,6 +36,46 @@
 #include <float.h>
 
 
+// Delivers the user events posted since the last call, in posting order
+//
+static void dispatchUserEvents(void)
+{
+    _GLFWuserevent* posted;
+    _GLFWuserevent* ordered = NULL;
+
+    posted = _glfwPlatformExchangePointer(&_glfw.userEvents.head, NULL);
+
+    // The posted events are most recent first
+    while (posted)
+    {
+        _GLFWuserevent* next = posted->next;
+        posted->next = ordered;
+        ordered = posted;
+        posted = next;
+    }
+
+    while (ordered)
+    {
+        _GLFWuserevent* next = ordered->next;
+
+        if (_glfw.callbacks.userEvent)
+            _glfw.callbacks.userEvent(ordered->payload);
+
+        _glfw_free(ordered);
+        ordered = next;
+    }
+}
+
+// Reports events that shared code holds back until the platform has processed
+// all available events
+//
+static void finishEventProcessing(void)
+{
+    _glfwFlushPendingInput();
+    dispatchUserEvents();
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -494,6 +534,26 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
         *prev = window->next;
     }
 
+    // Clear the handle from queued events, including those already returned,
+    // as a later window may be allocated at the same address
+    {
+        int i, j;
+
+        for (i = 0;  i < 2;  i++)
+        {
+            GLFWevent* events = _glfw.eventQueue.events[i];
+            const int count = (i == _glfw.eventQueue.current) ?
+                _glfw.eventQueue.count : _glfw.eventQueue.returnedCount;
+
+            for (j = 0;  j < count;  j++)
+            {
+                if (events[j].window == handle)
+                    events[j].window = NULL;
+            }
+        }
+    }
+
+    _glfw_free(window->cursorSamples);
     _glfw_free(window);
 }
 
@@ -1123,12 +1183,14 @@ GLFWAPI void glfwPollEvents(void)
 {
     _GLFW_REQUIRE_INIT();
     _glfw.platform.pollEvents();
+    finishEventProcessing();
 }
 
 GLFWAPI void glfwWaitEvents(void)
 {
     _GLFW_REQUIRE_INIT();
     _glfw.platform.waitEvents();
+    finishEventProcessing();
 }
 
 GLFWAPI void glfwWaitEventsTimeout(double timeout)
@@ -1145,6 +1207,133 @@ GLFWAPI void glfwWaitEventsTimeout(double timeout)
     }
 
     _glfw.platform.waitEventsTimeout(timeout);
+    finishEventProcessing();
+}
+
+GLFWAPI void glfwWaitEventsUntil(uint64_t timerValue)
+{
+    _GLFW_REQUIRE_INIT();
+    _glfw.platform.waitEventsUntil(timerValue);
+    finishEventProcessing();
+}
+
+GLFWAPI void glfwSetFramePacing(double period, double spin)
+{
+    uint64_t frequency;
+
+    _GLFW_REQUIRE_INIT();
+
+    if (period != period || period < 0.0 || period > 3600.0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid frame period %f", period);
+        return;
+    }
+
+    if (spin != spin || spin < 0.0 || spin > period)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid spin time %f", spin);
+        return;
+    }
+
+    frequency = _glfwPlatformGetTimerFrequency();
+
+    memset(&_glfw.pacer, 0, sizeof(_glfw.pacer));
+    _glfw.pacer.period = (uint64_t) (period * frequency);
+    _glfw.pacer.spin = (uint64_t) (spin * frequency);
+}
+
+GLFWAPI void glfwWaitFrame(void)
+{
+    uint64_t now;
+
+    _GLFW_REQUIRE_INIT();
+
+    if (_glfw.pacer.period && _glfw.pacer.deadline)
+    {
+        // Sleep in event processing until shortly before the deadline, so
+        // events are still handled as they arrive
+        const uint64_t wake = _glfw.pacer.deadline - _glfw.pacer.spin;
+
+        while (_glfwPlatformGetTimerValue() < wake)
+            _glfw.platform.waitEventsUntil(wake);
+    }
+
+    _glfw.platform.pollEvents();
+    finishEventProcessing();
+
+    now = _glfwPlatformGetTimerValue();
+
+    if (!_glfw.pacer.period)
+        return;
+
+    if (_glfw.pacer.deadline)
+    {
+        uint64_t frameTime;
+
+        // Spin through the remainder to avoid the wakeup latency of the
+        // scheduler
+        while (now < _glfw.pacer.deadline)
+            now = _glfwPlatformGetTimerValue();
+
+        frameTime = now - _glfw.pacer.start;
+
+        if (_glfw.pacer.frameCount == 0 || frameTime < _glfw.pacer.minimumTime)
+            _glfw.pacer.minimumTime = frameTime;
+        if (frameTime > _glfw.pacer.maximumTime)
+            _glfw.pacer.maximumTime = frameTime;
+        if (now - _glfw.pacer.deadline > _glfw.pacer.maximumLateness)
+            _glfw.pacer.maximumLateness = now - _glfw.pacer.deadline;
+
+        _glfw.pacer.totalTime += frameTime;
+        _glfw.pacer.frameCount++;
+
+        _glfw.pacer.deadline += _glfw.pacer.period;
+
+        // Start over from this frame if it already missed the next deadline,
+        // instead of trying to catch up with a burst of short frames
+        if (now >= _glfw.pacer.deadline)
+        {
+            _glfw.pacer.missedCount +=
+                (int) ((now - _glfw.pacer.deadline) / _glfw.pacer.period + 1);
+            _glfw.pacer.deadline = now + _glfw.pacer.period;
+        }
+    }
+    else
+        _glfw.pacer.deadline = now + _glfw.pacer.period;
+
+    _glfw.pacer.start = now;
+}
+
+GLFWAPI void glfwGetFrameStats(GLFWframestats* stats)
+{
+    double frequency;
+
+    assert(stats != NULL);
+
+    memset(stats, 0, sizeof(GLFWframestats));
+
+    _GLFW_REQUIRE_INIT();
+
+    frequency = (double) _glfwPlatformGetTimerFrequency();
+
+    stats->frameCount = _glfw.pacer.frameCount;
+    stats->missedCount = _glfw.pacer.missedCount;
+    stats->minimumTime = _glfw.pacer.minimumTime / frequency;
+    stats->maximumTime = _glfw.pacer.maximumTime / frequency;
+    stats->maximumLateness = _glfw.pacer.maximumLateness / frequency;
+
+    if (_glfw.pacer.frameCount)
+    {
+        stats->averageTime =
+            _glfw.pacer.totalTime / frequency / _glfw.pacer.frameCount;
+    }
+
+    _glfw.pacer.frameCount = 0;
+    _glfw.pacer.missedCount = 0;
+    _glfw.pacer.totalTime = 0;
+    _glfw.pacer.minimumTime = 0;
+    _glfw.pacer.maximumTime = 0;
+    _glfw.pacer.maximumLateness = 0;
 }
 
 GLFWAPI void glfwPostEmptyEvent(void)
@@ -1153,3 +1342,68 @@ GLFWAPI void glfwPostEmptyEvent(void)
     _glfw.platform.postEmptyEvent();
 }
 
+GLFWAPI void glfwPostUserEvent(void* payload)
+{
+    _GLFWuserevent* event;
+    void* head = NULL;
+
+    _GLFW_REQUIRE_INIT();
+
+    event = _glfw_calloc(1, sizeof(_GLFWuserevent));
+    if (!event)
+        return;
+
+    event->payload = payload;
+
+    for (;;)
+    {
+        void* previous;
+
+        event->next = head;
+        previous = _glfwPlatformCompareExchangePointer(&_glfw.userEvents.head,
+                                                       head, event);
+        if (previous == head)
+            break;
+
+        head = previous;
+    }
+
+    // Only wake the main thread for the first event since it last took them,
+    // as it will take all posted events at once
+    if (!head)
+        _glfw.platform.postEmptyEvent();
+}
+
+GLFWAPI GLFWusereventfun glfwSetUserEventCallback(GLFWusereventfun cbfun)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    _GLFW_SWAP(GLFWusereventfun, _glfw.callbacks.userEvent, cbfun);
+    return cbfun;
+}
+
+GLFWAPI const GLFWevent* glfwGetEventQueue(int* count)
+{
+    const GLFWevent* events;
+
+    assert(count != NULL);
+    *count = 0;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    // Any previously returned buffer is no longer valid
+    _glfw.eventQueue.returnedCount = 0;
+
+    if (!_glfw.eventQueue.count)
+        return NULL;
+
+    // Hand the recorded buffer to the application and record into the other
+    events = _glfw.eventQueue.events[_glfw.eventQueue.current];
+    *count = _glfw.eventQueue.count;
+
+    _glfw.eventQueue.returnedCount = _glfw.eventQueue.count;
+    _glfw.eventQueue.current ^= 1;
+    _glfw.eventQueue.count = 0;
+
+    return events;
+}
+
@@ -387,6 +387,7 @@ GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform)
         _glfwSetRawMouseMotionWayland,
         _glfwRawMouseMotionSupportedWayland,
         _glfwCreateCursorWayland,
+        _glfwCreateAnimatedCursorWayland,
         _glfwCreateStandardCursorWayland,
         _glfwDestroyCursorWayland,
         _glfwSetCursorWayland,
@@ -394,7 +395,7 @@ GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform)
         _glfwGetKeyScancodeWayland,
         _glfwSetClipboardStringWayland,
         _glfwGetClipboardStringWayland,
-#if defined(_GLFW_LINUX_JOYSTICK)
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
         _glfwInitJoysticksLinux,
         _glfwTerminateJoysticksLinux,
         _glfwPollJoystickLinux,
@@ -451,6 +452,7 @@ GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform)
         _glfwPollEventsWayland,
         _glfwWaitEventsWayland,
         _glfwWaitEventsTimeoutWayland,
+        _glfwWaitEventsUntilWayland,
         _glfwPostEmptyEventWayland,
         _glfwGetEGLPlatformWayland,
         _glfwGetEGLNativeDisplayWayland,
@@ -509,6 +511,8 @@ int _glfwInitWayland(void)
     _glfw.wl.keyRepeatTimerfd = -1;
     _glfw.wl.cursorTimerfd = -1;
 
+    _glfwInitPollPOSIX();
+
     _glfw.wl.client.display_flush = (PFN_wl_display_flush)
         _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_display_flush");
     _glfw.wl.client.display_cancel_read = (PFN_wl_display_cancel_read)
@@ -790,6 +794,8 @@ void _glfwTerminateWayland(void)
     if (_glfw.wl.cursorTimerfd >= 0)
         close(_glfw.wl.cursorTimerfd);
 
+    _glfwTerminatePollPOSIX();
+
     _glfw_free(_glfw.wl.clipboardString);
 }
 
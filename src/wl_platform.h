@@ -43,7 +43,7 @@ typedef VkResult (APIENTRY *PFN_vkCreateWaylandSurfaceKHR)(VkInstance,const VkWa
 typedef VkBool32 (APIENTRY *PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR)(VkPhysicalDevice,uint32_t,struct wl_display*);
 
 #include "xkb_unicode.h"
-#include "posix_poll.h"
+#include "pixel_convert.h"
 
 typedef int (* PFN_wl_display_flush)(struct wl_display* display);
 typedef void (* PFN_wl_display_cancel_read)(struct wl_display* display);
@@ -426,6 +426,16 @@ typedef struct _GLFWmonitorWayland
     int                         scale;
 } _GLFWmonitorWayland;
 
+// Wayland-specific frame of an animated custom cursor
+//
+typedef struct _GLFWcursorframeWayland
+{
+    struct wl_buffer*           buffer;
+    int                         width, height;
+    // Time the frame is shown, in nanoseconds
+    uint64_t                    delay;
+} _GLFWcursorframeWayland;
+
 // Wayland-specific per-cursor data
 //
 typedef struct _GLFWcursorWayland
@@ -436,6 +446,8 @@ typedef struct _GLFWcursorWayland
     int                         width, height;
     int                         xhot, yhot;
     int                         currentImage;
+    _GLFWcursorframeWayland*    frames;
+    int                         frameCount;
 } _GLFWcursorWayland;
 
 GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform);
@@ -482,6 +494,7 @@ GLFWbool _glfwRawMouseMotionSupportedWayland(void);
 void _glfwPollEventsWayland(void);
 void _glfwWaitEventsWayland(void);
 void _glfwWaitEventsTimeoutWayland(double timeout);
+void _glfwWaitEventsUntilWayland(uint64_t timerValue);
 void _glfwPostEmptyEventWayland(void);
 
 void _glfwGetCursorPosWayland(_GLFWwindow* window, double* xpos, double* ypos);
@@ -490,6 +503,7 @@ void _glfwSetCursorModeWayland(_GLFWwindow* window, int mode);
 const char* _glfwGetScancodeNameWayland(int scancode);
 int _glfwGetKeyScancodeWayland(int key);
 GLFWbool _glfwCreateCursorWayland(_GLFWcursor* cursor, const GLFWimage* image, int xhot, int yhot);
+GLFWbool _glfwCreateAnimatedCursorWayland(_GLFWcursor* cursor, const GLFWimage* images, int count, const double* delays, int xhot, int yhot);
 GLFWbool _glfwCreateStandardCursorWayland(_GLFWcursor* cursor, int shape);
 void _glfwDestroyCursorWayland(_GLFWcursor* cursor);
 void _glfwSetCursorWayland(_GLFWwindow* window, _GLFWcursor* cursor);
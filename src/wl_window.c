@@ -169,17 +169,16 @@ static struct wl_buffer* createShmBuffer(const GLFWimage* image)
 
     close(fd);
 
-    unsigned char* source = (unsigned char*) image->pixels;
-    unsigned char* target = data;
-    for (int i = 0;  i < image->width * image->height;  i++, source += 4)
-    {
-        unsigned int alpha = source[3];
+    const size_t count = (size_t) image->width * image->height;
+    uint32_t* target = data;
 
-        *target++ = (unsigned char) ((source[2] * alpha) / 255);
-        *target++ = (unsigned char) ((source[1] * alpha) / 255);
-        *target++ = (unsigned char) ((source[0] * alpha) / 255);
-        *target++ = (unsigned char) alpha;
-    }
+    _glfwConvertPixelsARGB(target, image->pixels, count, GLFW_TRUE);
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    // ARGB8888 is little-endian regardless of the host byte order
+    for (size_t i = 0;  i < count;  i++)
+        target[i] = __builtin_bswap32(target[i]);
+#endif
 
     struct wl_buffer* buffer =
         wl_shm_pool_create_buffer(pool, 0,
@@ -754,7 +753,21 @@ static void setCursorImage(_GLFWwindow* window,
     struct wl_surface* surface = _glfw.wl.cursorSurface;
     int scale = 1;
 
-    if (!wlCursor)
+    if (cursorWayland->frames)
+    {
+        const _GLFWcursorframeWayland* frame =
+            cursorWayland->frames + cursorWayland->currentImage;
+
+        buffer = frame->buffer;
+
+        timer.it_value.tv_sec = frame->delay / 1000000000;
+        timer.it_value.tv_nsec = frame->delay % 1000000000;
+        timerfd_settime(_glfw.wl.cursorTimerfd, 0, &timer, NULL);
+
+        cursorWayland->width = frame->width;
+        cursorWayland->height = frame->height;
+    }
+    else if (!wlCursor)
         buffer = cursorWayland->buffer;
     else
     {
@@ -798,7 +811,13 @@ static void incrementCursorImage(_GLFWwindow* window)
         return;
 
     cursor = window->wl.currentCursor;
-    if (cursor && cursor->wl.cursor)
+    if (cursor && cursor->wl.frames)
+    {
+        cursor->wl.currentImage += 1;
+        cursor->wl.currentImage %= cursor->wl.frameCount;
+        setCursorImage(window, &cursor->wl);
+    }
+    else if (cursor && cursor->wl.cursor)
     {
         cursor->wl.currentImage += 1;
         cursor->wl.currentImage %= cursor->wl.cursor->image_count;
@@ -871,7 +890,7 @@ static void inputText(_GLFWwindow* window, uint32_t scancode)
     }
 }
 
-static void handleEvents(double* timeout)
+static void handleEvents(const uint64_t* deadline)
 {
     GLFWbool event = GLFW_FALSE;
     struct pollfd fds[] =
@@ -879,8 +898,20 @@ static void handleEvents(double* timeout)
         { wl_display_get_fd(_glfw.wl.display), POLLIN },
         { _glfw.wl.keyRepeatTimerfd, POLLIN },
         { _glfw.wl.cursorTimerfd, POLLIN },
+        { -1, POLLIN },
     };
 
+    // Do not let input reported outside of event processing reuse a stale time
+    _glfwInputEventTime(0);
+
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
+    if (_glfw.joysticksInitialized)
+    {
+        fds[3].fd = _glfwGetJoystickWaitFdLinux();
+        _glfwPollJoystickEventsLinux();
+    }
+#endif
+
     while (!event)
     {
         while (wl_display_prepare_read(_glfw.wl.display) != 0)
@@ -902,7 +933,7 @@ static void handleEvents(double* timeout)
             return;
         }
 
-        if (!_glfwPollPOSIX(fds, 3, timeout))
+        if (!_glfwPollPOSIX(fds, sizeof(fds) / sizeof(fds[0]), deadline))
         {
             wl_display_cancel_read(_glfw.wl.display);
             return;
@@ -923,6 +954,9 @@ static void handleEvents(double* timeout)
 
             if (read(_glfw.wl.keyRepeatTimerfd, &repeats, sizeof(repeats)) == 8)
             {
+                // Key repeats are generated locally and have no native time
+                _glfwInputEventTime(0);
+
                 for (uint64_t i = 0; i < repeats; i++)
                 {
                     _glfwInputKey(_glfw.wl.keyboardFocus,
@@ -947,6 +981,14 @@ static void handleEvents(double* timeout)
                 event = GLFW_TRUE;
             }
         }
+
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
+        if (fds[3].revents & POLLIN)
+        {
+            _glfwPollJoystickEventsLinux();
+            event = GLFW_TRUE;
+        }
+#endif
     }
 }
 
@@ -1076,6 +1118,7 @@ static void pointerHandleEnter(void* userData,
     window->wl.hovered = GLFW_TRUE;
 
     _glfwSetCursorWayland(window, window->wl.currentCursor);
+    _glfwInputEventTime(0);
     _glfwInputCursorEnter(window, GLFW_TRUE);
 }
 
@@ -1094,6 +1137,7 @@ static void pointerHandleLeave(void* userData,
     _glfw.wl.serial = serial;
     _glfw.wl.pointerFocus = NULL;
     _glfw.wl.cursorPreviousName = NULL;
+    _glfwInputEventTime(0);
     _glfwInputCursorEnter(window, GLFW_FALSE);
 }
 
@@ -1157,6 +1201,9 @@ static void pointerHandleMotion(void* userData,
 
     if (window->cursorMode == GLFW_CURSOR_DISABLED)
         return;
+
+    _glfwInputEventTime(_glfwMillisecondsToTimerValue(time));
+
     x = wl_fixed_to_double(sx);
     y = wl_fixed_to_double(sy);
     window->wl.cursorPosX = x;
@@ -1278,6 +1325,8 @@ static void pointerHandleButton(void* userData,
      * codes. */
     glfwButton = button - BTN_LEFT;
 
+    _glfwInputEventTime(_glfwMillisecondsToTimerValue(time));
+
     _glfwInputMouseClick(window,
                          glfwButton,
                          state == WL_POINTER_BUTTON_STATE_PRESSED
@@ -1310,6 +1359,7 @@ static void pointerHandleAxis(void* userData,
     else if (axis == WL_POINTER_AXIS_VERTICAL_SCROLL)
         y = -wl_fixed_to_double(value) * scrollFactor;
 
+    _glfwInputEventTime(_glfwMillisecondsToTimerValue(time));
     _glfwInputScroll(window, x, y);
 }
 
@@ -1451,6 +1501,7 @@ static void keyboardHandleLeave(void* userData,
 
     _glfw.wl.serial = serial;
     _glfw.wl.keyboardFocus = NULL;
+    _glfwInputEventTime(0);
     _glfwInputWindowFocus(window, GLFW_FALSE);
 }
 
@@ -1493,6 +1544,7 @@ static void keyboardHandleKey(void* userData,
 
     timerfd_settime(_glfw.wl.keyRepeatTimerfd, 0, &timer, NULL);
 
+    _glfwInputEventTime(_glfwMillisecondsToTimerValue(time));
     _glfwInputKey(window, key, scancode, action, _glfw.wl.xkb.modifiers);
 
     if (action == GLFW_PRESS)
@@ -1725,6 +1777,8 @@ static void dataDeviceHandleDrop(void* userData,
     if (!_glfw.wl.dragOffer)
         return;
 
+    _glfwInputEventTime(0);
+
     char* string = readDataOfferAsString(_glfw.wl.dragOffer, "text/uri-list");
     if (string)
     {
@@ -2224,8 +2278,8 @@ GLFWbool _glfwRawMouseMotionSupportedWayland(void)
 
 void _glfwPollEventsWayland(void)
 {
-    double timeout = 0.0;
-    handleEvents(&timeout);
+    const uint64_t deadline = 0;
+    handleEvents(&deadline);
 }
 
 void _glfwWaitEventsWayland(void)
@@ -2235,7 +2289,13 @@ void _glfwWaitEventsWayland(void)
 
 void _glfwWaitEventsTimeoutWayland(double timeout)
 {
-    handleEvents(&timeout);
+    const uint64_t deadline = _glfwTimeoutToDeadlinePOSIX(timeout);
+    handleEvents(&deadline);
+}
+
+void _glfwWaitEventsUntilWayland(uint64_t timerValue)
+{
+    handleEvents(&timerValue);
 }
 
 void _glfwPostEmptyEventWayland(void)
@@ -2338,6 +2398,37 @@ GLFWbool _glfwCreateCursorWayland(_GLFWcursor* cursor,
     return GLFW_TRUE;
 }
 
+GLFWbool _glfwCreateAnimatedCursorWayland(_GLFWcursor* cursor,
+                                          const GLFWimage* images,
+                                          int count,
+                                          const double* delays,
+                                          int xhot, int yhot)
+{
+    cursor->wl.frames = _glfw_calloc(count, sizeof(_GLFWcursorframeWayland));
+    cursor->wl.frameCount = count;
+
+    for (int i = 0;  i < count;  i++)
+    {
+        _GLFWcursorframeWayland* frame = cursor->wl.frames + i;
+
+        frame->buffer = createShmBuffer(images + i);
+        if (!frame->buffer)
+            return GLFW_FALSE;
+
+        frame->width = images[i].width;
+        frame->height = images[i].height;
+        frame->delay = (uint64_t) (delays[i] * 1e9);
+        if (frame->delay == 0)
+            frame->delay = 1;
+    }
+
+    cursor->wl.width = images[0].width;
+    cursor->wl.height = images[0].height;
+    cursor->wl.xhot = xhot;
+    cursor->wl.yhot = yhot;
+    return GLFW_TRUE;
+}
+
 GLFWbool _glfwCreateStandardCursorWayland(_GLFWcursor* cursor, int shape)
 {
     const char* name = NULL;
@@ -2447,6 +2538,17 @@ void _glfwDestroyCursorWayland(_GLFWcursor* cursor)
 
     if (cursor->wl.buffer)
         wl_buffer_destroy(cursor->wl.buffer);
+
+    if (cursor->wl.frames)
+    {
+        for (int i = 0;  i < cursor->wl.frameCount;  i++)
+        {
+            if (cursor->wl.frames[i].buffer)
+                wl_buffer_destroy(cursor->wl.frames[i].buffer);
+        }
+
+        _glfw_free(cursor->wl.frames);
+    }
 }
 
 static void relativePointerHandleRelativeMotion(void* userData,
@@ -41,6 +41,10 @@
 #include <errno.h>
 #include <assert.h>
 
+#if defined(__linux__)
+ #include <sys/eventfd.h>
+#endif
+
 
 // Translate the X11 KeySyms for a key to a GLFW key code
 // NOTE: This is only used as a fallback, in case the XKB method fails
@@ -494,21 +498,38 @@ static void inputMethodInstantiateCallback(Display* display,
     }
 }
 
-// Return the atom ID only if it is listed in the specified array
+// Interns the specified atoms with a single round trip
 //
-static Atom getAtomIfSupported(Atom* supportedAtoms,
-                               unsigned long atomCount,
-                               const char* atomName)
+static void internAtoms(const _GLFWatomrequestX11* requests, int count)
 {
-    const Atom atom = XInternAtom(_glfw.x11.display, atomName, False);
+    char** names = _glfw_calloc(count, sizeof(char*));
+    Atom* atoms = _glfw_calloc(count, sizeof(Atom));
+
+    for (int i = 0;  i < count;  i++)
+        names[i] = (char*) requests[i].name;
+
+    XInternAtoms(_glfw.x11.display, names, count, False, atoms);
+
+    for (int i = 0;  i < count;  i++)
+        *requests[i].atom = atoms[i];
 
+    _glfw_free(names);
+    _glfw_free(atoms);
+}
+
+// Returns whether the atom is listed in the specified array
+//
+static GLFWbool isAtomSupported(Atom* supportedAtoms,
+                                unsigned long atomCount,
+                                Atom atom)
+{
     for (unsigned long i = 0;  i < atomCount;  i++)
     {
         if (supportedAtoms[i] == atom)
-            return atom;
+            return GLFW_TRUE;
     }
 
-    return None;
+    return GLFW_FALSE;
 }
 
 // Check whether the running window manager is EWMH-compliant
@@ -569,34 +590,31 @@ static void detectEWMH(void)
 
     // See which of the atoms we support that are supported by the WM
 
-    _glfw.x11.NET_WM_STATE =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_WM_STATE");
-    _glfw.x11.NET_WM_STATE_ABOVE =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_WM_STATE_ABOVE");
-    _glfw.x11.NET_WM_STATE_FULLSCREEN =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_WM_STATE_FULLSCREEN");
-    _glfw.x11.NET_WM_STATE_MAXIMIZED_VERT =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_WM_STATE_MAXIMIZED_VERT");
-    _glfw.x11.NET_WM_STATE_MAXIMIZED_HORZ =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_WM_STATE_MAXIMIZED_HORZ");
-    _glfw.x11.NET_WM_STATE_DEMANDS_ATTENTION =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_WM_STATE_DEMANDS_ATTENTION");
-    _glfw.x11.NET_WM_FULLSCREEN_MONITORS =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_WM_FULLSCREEN_MONITORS");
-    _glfw.x11.NET_WM_WINDOW_TYPE =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_WM_WINDOW_TYPE");
-    _glfw.x11.NET_WM_WINDOW_TYPE_NORMAL =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_WM_WINDOW_TYPE_NORMAL");
-    _glfw.x11.NET_WORKAREA =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_WORKAREA");
-    _glfw.x11.NET_CURRENT_DESKTOP =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_CURRENT_DESKTOP");
-    _glfw.x11.NET_ACTIVE_WINDOW =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_ACTIVE_WINDOW");
-    _glfw.x11.NET_FRAME_EXTENTS =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_FRAME_EXTENTS");
-    _glfw.x11.NET_REQUEST_FRAME_EXTENTS =
-        getAtomIfSupported(supportedAtoms, atomCount, "_NET_REQUEST_FRAME_EXTENTS");
+    const _GLFWatomrequestX11 atoms[] =
+    {
+        { "_NET_WM_STATE", &_glfw.x11.NET_WM_STATE },
+        { "_NET_WM_STATE_ABOVE", &_glfw.x11.NET_WM_STATE_ABOVE },
+        { "_NET_WM_STATE_FULLSCREEN", &_glfw.x11.NET_WM_STATE_FULLSCREEN },
+        { "_NET_WM_STATE_MAXIMIZED_VERT", &_glfw.x11.NET_WM_STATE_MAXIMIZED_VERT },
+        { "_NET_WM_STATE_MAXIMIZED_HORZ", &_glfw.x11.NET_WM_STATE_MAXIMIZED_HORZ },
+        { "_NET_WM_STATE_DEMANDS_ATTENTION", &_glfw.x11.NET_WM_STATE_DEMANDS_ATTENTION },
+        { "_NET_WM_FULLSCREEN_MONITORS", &_glfw.x11.NET_WM_FULLSCREEN_MONITORS },
+        { "_NET_WM_WINDOW_TYPE", &_glfw.x11.NET_WM_WINDOW_TYPE },
+        { "_NET_WM_WINDOW_TYPE_NORMAL", &_glfw.x11.NET_WM_WINDOW_TYPE_NORMAL },
+        { "_NET_WORKAREA", &_glfw.x11.NET_WORKAREA },
+        { "_NET_CURRENT_DESKTOP", &_glfw.x11.NET_CURRENT_DESKTOP },
+        { "_NET_ACTIVE_WINDOW", &_glfw.x11.NET_ACTIVE_WINDOW },
+        { "_NET_FRAME_EXTENTS", &_glfw.x11.NET_FRAME_EXTENTS },
+        { "_NET_REQUEST_FRAME_EXTENTS", &_glfw.x11.NET_REQUEST_FRAME_EXTENTS }
+    };
+
+    internAtoms(atoms, sizeof(atoms) / sizeof(atoms[0]));
+
+    for (size_t i = 0;  i < sizeof(atoms) / sizeof(atoms[0]);  i++)
+    {
+        if (!isAtomSupported(supportedAtoms, atomCount, *atoms[i].atom))
+            *atoms[i].atom = None;
+    }
 
     if (supportedAtoms)
         XFree(supportedAtoms);
@@ -775,6 +793,12 @@ static GLFWbool initExtensions(void)
             _glfwPlatformGetModuleSymbol(_glfw.x11.xcursor.handle, "XcursorGetDefaultSize");
         _glfw.x11.xcursor.LibraryLoadImage = (PFN_XcursorLibraryLoadImage)
             _glfwPlatformGetModuleSymbol(_glfw.x11.xcursor.handle, "XcursorLibraryLoadImage");
+        _glfw.x11.xcursor.ImagesCreate = (PFN_XcursorImagesCreate)
+            _glfwPlatformGetModuleSymbol(_glfw.x11.xcursor.handle, "XcursorImagesCreate");
+        _glfw.x11.xcursor.ImagesDestroy = (PFN_XcursorImagesDestroy)
+            _glfwPlatformGetModuleSymbol(_glfw.x11.xcursor.handle, "XcursorImagesDestroy");
+        _glfw.x11.xcursor.ImagesLoadCursor = (PFN_XcursorImagesLoadCursor)
+            _glfwPlatformGetModuleSymbol(_glfw.x11.xcursor.handle, "XcursorImagesLoadCursor");
     }
 
 #if defined(__CYGWIN__)
@@ -912,76 +936,63 @@ static GLFWbool initExtensions(void)
     // the keyboard mapping.
     createKeyTables();
 
-    // String format atoms
-    _glfw.x11.NULL_ = XInternAtom(_glfw.x11.display, "NULL", False);
-    _glfw.x11.UTF8_STRING = XInternAtom(_glfw.x11.display, "UTF8_STRING", False);
-    _glfw.x11.ATOM_PAIR = XInternAtom(_glfw.x11.display, "ATOM_PAIR", False);
-
-    // Custom selection property atom
-    _glfw.x11.GLFW_SELECTION =
-        XInternAtom(_glfw.x11.display, "GLFW_SELECTION", False);
-
-    // ICCCM standard clipboard atoms
-    _glfw.x11.TARGETS = XInternAtom(_glfw.x11.display, "TARGETS", False);
-    _glfw.x11.MULTIPLE = XInternAtom(_glfw.x11.display, "MULTIPLE", False);
-    _glfw.x11.PRIMARY = XInternAtom(_glfw.x11.display, "PRIMARY", False);
-    _glfw.x11.INCR = XInternAtom(_glfw.x11.display, "INCR", False);
-    _glfw.x11.CLIPBOARD = XInternAtom(_glfw.x11.display, "CLIPBOARD", False);
-
-    // Clipboard manager atoms
-    _glfw.x11.CLIPBOARD_MANAGER =
-        XInternAtom(_glfw.x11.display, "CLIPBOARD_MANAGER", False);
-    _glfw.x11.SAVE_TARGETS =
-        XInternAtom(_glfw.x11.display, "SAVE_TARGETS", False);
-
-    // Xdnd (drag and drop) atoms
-    _glfw.x11.XdndAware = XInternAtom(_glfw.x11.display, "XdndAware", False);
-    _glfw.x11.XdndEnter = XInternAtom(_glfw.x11.display, "XdndEnter", False);
-    _glfw.x11.XdndPosition = XInternAtom(_glfw.x11.display, "XdndPosition", False);
-    _glfw.x11.XdndStatus = XInternAtom(_glfw.x11.display, "XdndStatus", False);
-    _glfw.x11.XdndActionCopy = XInternAtom(_glfw.x11.display, "XdndActionCopy", False);
-    _glfw.x11.XdndDrop = XInternAtom(_glfw.x11.display, "XdndDrop", False);
-    _glfw.x11.XdndFinished = XInternAtom(_glfw.x11.display, "XdndFinished", False);
-    _glfw.x11.XdndSelection = XInternAtom(_glfw.x11.display, "XdndSelection", False);
-    _glfw.x11.XdndTypeList = XInternAtom(_glfw.x11.display, "XdndTypeList", False);
-    _glfw.x11.text_uri_list = XInternAtom(_glfw.x11.display, "text/uri-list", False);
-
-    // ICCCM, EWMH and Motif window property atoms
-    // These can be set safely even without WM support
-    // The EWMH atoms that require WM support are handled in detectEWMH
-    _glfw.x11.WM_PROTOCOLS =
-        XInternAtom(_glfw.x11.display, "WM_PROTOCOLS", False);
-    _glfw.x11.WM_STATE =
-        XInternAtom(_glfw.x11.display, "WM_STATE", False);
-    _glfw.x11.WM_DELETE_WINDOW =
-        XInternAtom(_glfw.x11.display, "WM_DELETE_WINDOW", False);
-    _glfw.x11.NET_SUPPORTED =
-        XInternAtom(_glfw.x11.display, "_NET_SUPPORTED", False);
-    _glfw.x11.NET_SUPPORTING_WM_CHECK =
-        XInternAtom(_glfw.x11.display, "_NET_SUPPORTING_WM_CHECK", False);
-    _glfw.x11.NET_WM_ICON =
-        XInternAtom(_glfw.x11.display, "_NET_WM_ICON", False);
-    _glfw.x11.NET_WM_PING =
-        XInternAtom(_glfw.x11.display, "_NET_WM_PING", False);
-    _glfw.x11.NET_WM_PID =
-        XInternAtom(_glfw.x11.display, "_NET_WM_PID", False);
-    _glfw.x11.NET_WM_NAME =
-        XInternAtom(_glfw.x11.display, "_NET_WM_NAME", False);
-    _glfw.x11.NET_WM_ICON_NAME =
-        XInternAtom(_glfw.x11.display, "_NET_WM_ICON_NAME", False);
-    _glfw.x11.NET_WM_BYPASS_COMPOSITOR =
-        XInternAtom(_glfw.x11.display, "_NET_WM_BYPASS_COMPOSITOR", False);
-    _glfw.x11.NET_WM_WINDOW_OPACITY =
-        XInternAtom(_glfw.x11.display, "_NET_WM_WINDOW_OPACITY", False);
-    _glfw.x11.MOTIF_WM_HINTS =
-        XInternAtom(_glfw.x11.display, "_MOTIF_WM_HINTS", False);
-
     // The compositing manager selection name contains the screen number
+    char cmName[32];
+    snprintf(cmName, sizeof(cmName), "_NET_WM_CM_S%u", _glfw.x11.screen);
+
+    const _GLFWatomrequestX11 atoms[] =
     {
-        char name[32];
-        snprintf(name, sizeof(name), "_NET_WM_CM_S%u", _glfw.x11.screen);
-        _glfw.x11.NET_WM_CM_Sx = XInternAtom(_glfw.x11.display, name, False);
-    }
+        // String format atoms
+        { "NULL", &_glfw.x11.NULL_ },
+        { "UTF8_STRING", &_glfw.x11.UTF8_STRING },
+        { "ATOM_PAIR", &_glfw.x11.ATOM_PAIR },
+
+        // Custom selection property atom
+        { "GLFW_SELECTION", &_glfw.x11.GLFW_SELECTION },
+
+        // ICCCM standard clipboard atoms
+        { "TARGETS", &_glfw.x11.TARGETS },
+        { "MULTIPLE", &_glfw.x11.MULTIPLE },
+        { "PRIMARY", &_glfw.x11.PRIMARY },
+        { "INCR", &_glfw.x11.INCR },
+        { "CLIPBOARD", &_glfw.x11.CLIPBOARD },
+
+        // Clipboard manager atoms
+        { "CLIPBOARD_MANAGER", &_glfw.x11.CLIPBOARD_MANAGER },
+        { "SAVE_TARGETS", &_glfw.x11.SAVE_TARGETS },
+
+        // Xdnd (drag and drop) atoms
+        { "XdndAware", &_glfw.x11.XdndAware },
+        { "XdndEnter", &_glfw.x11.XdndEnter },
+        { "XdndPosition", &_glfw.x11.XdndPosition },
+        { "XdndStatus", &_glfw.x11.XdndStatus },
+        { "XdndActionCopy", &_glfw.x11.XdndActionCopy },
+        { "XdndDrop", &_glfw.x11.XdndDrop },
+        { "XdndFinished", &_glfw.x11.XdndFinished },
+        { "XdndSelection", &_glfw.x11.XdndSelection },
+        { "XdndTypeList", &_glfw.x11.XdndTypeList },
+        { "text/uri-list", &_glfw.x11.text_uri_list },
+
+        // ICCCM, EWMH and Motif window property atoms
+        // These can be set safely even without WM support
+        // The EWMH atoms that require WM support are handled in detectEWMH
+        { "WM_PROTOCOLS", &_glfw.x11.WM_PROTOCOLS },
+        { "WM_STATE", &_glfw.x11.WM_STATE },
+        { "WM_DELETE_WINDOW", &_glfw.x11.WM_DELETE_WINDOW },
+        { "_NET_SUPPORTED", &_glfw.x11.NET_SUPPORTED },
+        { "_NET_SUPPORTING_WM_CHECK", &_glfw.x11.NET_SUPPORTING_WM_CHECK },
+        { "_NET_WM_ICON", &_glfw.x11.NET_WM_ICON },
+        { "_NET_WM_PING", &_glfw.x11.NET_WM_PING },
+        { "_NET_WM_PID", &_glfw.x11.NET_WM_PID },
+        { "_NET_WM_NAME", &_glfw.x11.NET_WM_NAME },
+        { "_NET_WM_ICON_NAME", &_glfw.x11.NET_WM_ICON_NAME },
+        { "_NET_WM_BYPASS_COMPOSITOR", &_glfw.x11.NET_WM_BYPASS_COMPOSITOR },
+        { "_NET_WM_WINDOW_OPACITY", &_glfw.x11.NET_WM_WINDOW_OPACITY },
+        { "_MOTIF_WM_HINTS", &_glfw.x11.MOTIF_WM_HINTS },
+        { cmName, &_glfw.x11.NET_WM_CM_Sx }
+    };
+
+    internAtoms(atoms, sizeof(atoms) / sizeof(atoms[0]));
 
     // Detect whether an EWMH-conformant window manager is running
     detectEWMH();
@@ -1048,9 +1059,25 @@ static Window createHelperWindow(void)
 }
 
 // Create the pipe for empty events without assumuing the OS has pipe2(2)
+// On Linux an eventfd is used as both ends, as it collapses repeated writes into
+// a single counter
 //
 static GLFWbool createEmptyEventPipe(void)
 {
+#if defined(__linux__)
+    const int fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (fd == -1)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "X11: Failed to create empty event eventfd: %s",
+                        strerror(errno));
+        return GLFW_FALSE;
+    }
+
+    _glfw.x11.emptyEventPipe[0] = fd;
+    _glfw.x11.emptyEventPipe[1] = fd;
+    return GLFW_TRUE;
+#else
     if (pipe(_glfw.x11.emptyEventPipe) != 0)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
@@ -1076,6 +1103,7 @@ static GLFWbool createEmptyEventPipe(void)
     }
 
     return GLFW_TRUE;
+#endif
 }
 
 // X error handler
@@ -1140,18 +1168,9 @@ Cursor _glfwCreateNativeCursorX11(const GLFWimage* image, int xhot, int yhot)
     native->xhot = xhot;
     native->yhot = yhot;
 
-    unsigned char* source = (unsigned char*) image->pixels;
-    XcursorPixel* target = native->pixels;
-
-    for (int i = 0;  i < image->width * image->height;  i++, target++, source += 4)
-    {
-        unsigned int alpha = source[3];
-
-        *target = (alpha << 24) |
-                  ((unsigned char) ((source[0] * alpha) / 255) << 16) |
-                  ((unsigned char) ((source[1] * alpha) / 255) <<  8) |
-                  ((unsigned char) ((source[2] * alpha) / 255) <<  0);
-    }
+    _glfwConvertPixelsARGB(native->pixels, image->pixels,
+                           (size_t) image->width * image->height,
+                           GLFW_TRUE);
 
     cursor = XcursorImageLoadCursor(_glfw.x11.display, native);
     XcursorImageDestroy(native);
@@ -1177,6 +1196,7 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
         _glfwSetRawMouseMotionX11,
         _glfwRawMouseMotionSupportedX11,
         _glfwCreateCursorX11,
+        _glfwCreateAnimatedCursorX11,
         _glfwCreateStandardCursorX11,
         _glfwDestroyCursorX11,
         _glfwSetCursorX11,
@@ -1184,7 +1204,7 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
         _glfwGetKeyScancodeX11,
         _glfwSetClipboardStringX11,
         _glfwGetClipboardStringX11,
-#if defined(_GLFW_LINUX_JOYSTICK)
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
         _glfwInitJoysticksLinux,
         _glfwTerminateJoysticksLinux,
         _glfwPollJoystickLinux,
@@ -1241,6 +1261,7 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
         _glfwPollEventsX11,
         _glfwWaitEventsX11,
         _glfwWaitEventsTimeoutX11,
+        _glfwWaitEventsUntilX11,
         _glfwPostEmptyEventX11,
         _glfwGetEGLPlatformX11,
         _glfwGetEGLNativeDisplayX11,
@@ -1411,6 +1432,8 @@ int _glfwInitX11(void)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XIconifyWindow");
     _glfw.x11.xlib.InternAtom = (PFN_XInternAtom)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XInternAtom");
+    _glfw.x11.xlib.InternAtoms = (PFN_XInternAtoms)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XInternAtoms");
     _glfw.x11.xlib.LookupString = (PFN_XLookupString)
         _glfwPlatformGetModuleSymbol(_glfw.x11.xlib.handle, "XLookupString");
     _glfw.x11.xlib.MapRaised = (PFN_XMapRaised)
@@ -1532,6 +1555,8 @@ int _glfwInitX11(void)
     if (!createEmptyEventPipe())
         return GLFW_FALSE;
 
+    _glfwInitPollPOSIX();
+
     if (!initExtensions())
         return GLFW_FALSE;
 
@@ -1575,6 +1600,8 @@ void _glfwTerminateX11(void)
 
     _glfw_free(_glfw.x11.primarySelectionString);
     _glfw_free(_glfw.x11.clipboardString);
+    _glfw_free(_glfw.x11.icon.data);
+    _glfw_free(_glfw.x11.icon.pixels);
 
     XUnregisterIMInstantiateCallback(_glfw.x11.display,
                                      NULL, NULL, NULL,
@@ -1650,8 +1677,11 @@ void _glfwTerminateX11(void)
     if (_glfw.x11.emptyEventPipe[0] || _glfw.x11.emptyEventPipe[1])
     {
         close(_glfw.x11.emptyEventPipe[0]);
-        close(_glfw.x11.emptyEventPipe[1]);
+        if (_glfw.x11.emptyEventPipe[1] != _glfw.x11.emptyEventPipe[0])
+            close(_glfw.x11.emptyEventPipe[1]);
     }
+
+    _glfwTerminatePollPOSIX();
 }
 
 #endif // _GLFW_X11
@@ -143,6 +143,7 @@ typedef int (* PFN_XGrabPointer)(Display*,Window,Bool,unsigned int,int,int,Windo
 typedef Status (* PFN_XIconifyWindow)(Display*,Window,int);
 typedef Status (* PFN_XInitThreads)(void);
 typedef Atom (* PFN_XInternAtom)(Display*,const char*,Bool);
+typedef Status (* PFN_XInternAtoms)(Display*,char**,int,Bool,Atom*);
 typedef int (* PFN_XLookupString)(XKeyEvent*,char*,int,KeySym*,XComposeStatus*);
 typedef int (* PFN_XMapRaised)(Display*,Window);
 typedef int (* PFN_XMapWindow)(Display*,Window);
@@ -244,6 +245,7 @@ typedef void (* PFN_Xutf8SetWMProperties)(Display*,Window,const char*,const char
 #define XGrabPointer _glfw.x11.xlib.GrabPointer
 #define XIconifyWindow _glfw.x11.xlib.IconifyWindow
 #define XInternAtom _glfw.x11.xlib.InternAtom
+#define XInternAtoms _glfw.x11.xlib.InternAtoms
 #define XLookupString _glfw.x11.xlib.LookupString
 #define XMapRaised _glfw.x11.xlib.MapRaised
 #define XMapWindow _glfw.x11.xlib.MapWindow
@@ -340,12 +342,18 @@ typedef Cursor (* PFN_XcursorImageLoadCursor)(Display*,const XcursorImage*);
 typedef char* (* PFN_XcursorGetTheme)(Display*);
 typedef int (* PFN_XcursorGetDefaultSize)(Display*);
 typedef XcursorImage* (* PFN_XcursorLibraryLoadImage)(const char*,const char*,int);
+typedef XcursorImages* (* PFN_XcursorImagesCreate)(int);
+typedef void (* PFN_XcursorImagesDestroy)(XcursorImages*);
+typedef Cursor (* PFN_XcursorImagesLoadCursor)(Display*,const XcursorImages*);
 #define XcursorImageCreate _glfw.x11.xcursor.ImageCreate
 #define XcursorImageDestroy _glfw.x11.xcursor.ImageDestroy
 #define XcursorImageLoadCursor _glfw.x11.xcursor.ImageLoadCursor
 #define XcursorGetTheme _glfw.x11.xcursor.GetTheme
 #define XcursorGetDefaultSize _glfw.x11.xcursor.GetDefaultSize
 #define XcursorLibraryLoadImage _glfw.x11.xcursor.LibraryLoadImage
+#define XcursorImagesCreate _glfw.x11.xcursor.ImagesCreate
+#define XcursorImagesDestroy _glfw.x11.xcursor.ImagesDestroy
+#define XcursorImagesLoadCursor _glfw.x11.xcursor.ImagesLoadCursor
 
 typedef Bool (* PFN_XineramaIsActive)(Display*);
 typedef Bool (* PFN_XineramaQueryExtension)(Display*,int*,int*);
@@ -453,7 +461,7 @@ typedef VkResult (APIENTRY *PFN_vkCreateXcbSurfaceKHR)(VkInstance,const VkXcbSur
 typedef VkBool32 (APIENTRY *PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR)(VkPhysicalDevice,uint32_t,xcb_connection_t*,xcb_visualid_t);
 
 #include "xkb_unicode.h"
-#include "posix_poll.h"
+#include "pixel_convert.h"
 
 #define GLFW_X11_WINDOW_STATE           _GLFWwindowX11 x11;
 #define GLFW_X11_LIBRARY_WINDOW_STATE   _GLFWlibraryX11 x11;
@@ -550,6 +558,14 @@ typedef struct _GLFWwindowX11
 
 // X11-specific global data
 //
+// X11-specific atom to be interned and where to store it
+//
+typedef struct _GLFWatomrequestX11
+{
+    const char*     name;
+    Atom*           atom;
+} _GLFWatomrequestX11;
+
 typedef struct _GLFWlibraryX11
 {
     Display*        display;
@@ -574,6 +590,15 @@ typedef struct _GLFWlibraryX11
     char*           primarySelectionString;
     // Clipboard string (while the selection is owned)
     char*           clipboardString;
+    // Converted _NET_WM_ICON data of the most recently set window icon, with
+    // a copy of its source pixels for confirming cache hits
+    struct {
+        uint64_t        hash;
+        int             count;
+        unsigned long*  data;
+        int             longCount;
+        unsigned char*  pixels;
+    } icon;
     // Key name string
     char            keynames[GLFW_KEY_LAST + 1][5];
     // X11 keycode to GLFW key LUT
@@ -584,7 +609,14 @@ typedef struct _GLFWlibraryX11
     double          restoreCursorPosX, restoreCursorPosY;
     // The window whose disabled cursor mode is active
     _GLFWwindow*    disabledCursorWindow;
+    // The window of the most recent event and its handle, to avoid looking up
+    // the context for every event of a stream to the same window
+    Window          eventWindowHandle;
+    _GLFWwindow*    eventWindow;
+    // Read and write ends of the empty event pipe, or the same eventfd
     int             emptyEventPipe[2];
+    // Whether an empty event has been posted since the last drain
+    int             emptyEventPosted;
 
     // Window manager atoms
     Atom            NET_SUPPORTED;
@@ -690,6 +722,7 @@ typedef struct _GLFWlibraryX11
         PFN_XGrabPointer GrabPointer;
         PFN_XIconifyWindow IconifyWindow;
         PFN_XInternAtom InternAtom;
+        PFN_XInternAtoms InternAtoms;
         PFN_XLookupString LookupString;
         PFN_XMapRaised MapRaised;
         PFN_XMapWindow MapWindow;
@@ -810,6 +843,9 @@ typedef struct _GLFWlibraryX11
         PFN_XcursorGetTheme GetTheme;
         PFN_XcursorGetDefaultSize GetDefaultSize;
         PFN_XcursorLibraryLoadImage LibraryLoadImage;
+        PFN_XcursorImagesCreate ImagesCreate;
+        PFN_XcursorImagesDestroy ImagesDestroy;
+        PFN_XcursorImagesLoadCursor ImagesLoadCursor;
     } xcursor;
 
     struct {
@@ -941,6 +977,7 @@ GLFWbool _glfwRawMouseMotionSupportedX11(void);
 void _glfwPollEventsX11(void);
 void _glfwWaitEventsX11(void);
 void _glfwWaitEventsTimeoutX11(double timeout);
+void _glfwWaitEventsUntilX11(uint64_t timerValue);
 void _glfwPostEmptyEventX11(void);
 
 void _glfwGetCursorPosX11(_GLFWwindow* window, double* xpos, double* ypos);
@@ -949,6 +986,7 @@ void _glfwSetCursorModeX11(_GLFWwindow* window, int mode);
 const char* _glfwGetScancodeNameX11(int scancode);
 int _glfwGetKeyScancodeX11(int key);
 GLFWbool _glfwCreateCursorX11(_GLFWcursor* cursor, const GLFWimage* image, int xhot, int yhot);
+GLFWbool _glfwCreateAnimatedCursorX11(_GLFWcursor* cursor, const GLFWimage* images, int count, const double* delays, int xhot, int yhot);
 GLFWbool _glfwCreateStandardCursorX11(_GLFWcursor* cursor, int shape);
 void _glfwDestroyCursorX11(_GLFWcursor* cursor);
 void _glfwSetCursorX11(_GLFWwindow* window, _GLFWcursor* cursor);
@@ -62,24 +62,72 @@
 // This avoids blocking other threads via the per-display Xlib lock that also
 // covers GLX functions
 //
-static GLFWbool waitForX11Event(double* timeout)
+static GLFWbool waitForX11Event(const uint64_t* deadline)
 {
     struct pollfd fd = { ConnectionNumber(_glfw.x11.display), POLLIN };
 
     while (!XPending(_glfw.x11.display))
     {
-        if (!_glfwPollPOSIX(&fd, 1, timeout))
+        if (!_glfwPollPOSIX(&fd, 1, deadline))
             return GLFW_FALSE;
     }
 
     return GLFW_TRUE;
 }
 
+// Writes to the empty event pipe unless an empty event is already pending
+//
+static void writeEmptyEvent(void)
+{
+    if (__atomic_exchange_n(&_glfw.x11.emptyEventPosted, GLFW_TRUE, __ATOMIC_ACQ_REL))
+        return;
+
+    for (;;)
+    {
+#if defined(__linux__)
+        const uint64_t value = 1;
+        const ssize_t result = write(_glfw.x11.emptyEventPipe[1], &value, sizeof(value));
+        if (result == sizeof(value) || (result == -1 && errno != EINTR))
+            break;
+#else
+        const char byte = 0;
+        const ssize_t result = write(_glfw.x11.emptyEventPipe[1], &byte, 1);
+        if (result == 1 || (result == -1 && errno != EINTR))
+            break;
+#endif
+    }
+}
+
+// Drains available data from the empty event pipe
+//
+static void drainEmptyEvents(void)
+{
+    // Clear the flag before draining so that an empty event posted during the
+    // drain is either drained or written again
+    __atomic_store_n(&_glfw.x11.emptyEventPosted, GLFW_FALSE, __ATOMIC_SEQ_CST);
+
+    for (;;)
+    {
+#if defined(__linux__)
+        // A single read resets the eventfd counter
+        uint64_t value;
+        const ssize_t result = read(_glfw.x11.emptyEventPipe[0], &value, sizeof(value));
+        if (result == sizeof(value) || (result == -1 && errno != EINTR))
+            break;
+#else
+        char dummy[64];
+        const ssize_t result = read(_glfw.x11.emptyEventPipe[0], dummy, sizeof(dummy));
+        if (result == -1 && errno != EINTR)
+            break;
+#endif
+    }
+}
+
 // Wait for event data to arrive on any event file descriptor
 // This avoids blocking other threads via the per-display Xlib lock that also
 // covers GLX functions
 //
-static GLFWbool waitForAnyEvent(double* timeout)
+static GLFWbool waitForAnyEvent(const uint64_t* deadline)
 {
     nfds_t count = 2;
     struct pollfd fds[3] =
@@ -88,17 +136,30 @@ static GLFWbool waitForAnyEvent(double* timeout)
         { _glfw.x11.emptyEventPipe[0], POLLIN }
     };
 
-#if defined(_GLFW_LINUX_JOYSTICK)
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
     if (_glfw.joysticksInitialized)
-        fds[count++] = (struct pollfd) { _glfw.linjs.inotify, POLLIN };
+        fds[count++] = (struct pollfd) { _glfwGetJoystickWaitFdLinux(), POLLIN };
 #endif
 
+    // An empty event may have been posted after the last drain with its write
+    // skipped, or the write may have been consumed by that drain
+    if (__atomic_load_n(&_glfw.x11.emptyEventPosted, __ATOMIC_ACQUIRE))
+        return GLFW_TRUE;
+
     while (!XPending(_glfw.x11.display))
     {
-        if (!_glfwPollPOSIX(fds, count, timeout))
+        if (!_glfwPollPOSIX(fds, count, deadline))
             return GLFW_FALSE;
 
-        for (int i = 1; i < count; i++)
+        // NOTE: The pipe is drained here whenever it is readable, as a write
+        //       can land after a drain has already cleared the posted flag
+        if (fds[1].revents & POLLIN)
+        {
+            drainEmptyEvents();
+            return GLFW_TRUE;
+        }
+
+        for (int i = 2; i < count; i++)
         {
             if (fds[i].revents & POLLIN)
                 return GLFW_TRUE;
@@ -108,52 +169,34 @@ static GLFWbool waitForAnyEvent(double* timeout)
     return GLFW_TRUE;
 }
 
-// Writes a byte to the empty event pipe
-//
-static void writeEmptyEvent(void)
-{
-    for (;;)
-    {
-        const char byte = 0;
-        const ssize_t result = write(_glfw.x11.emptyEventPipe[1], &byte, 1);
-        if (result == 1 || (result == -1 && errno != EINTR))
-            break;
-    }
-}
-
-// Drains available data from the empty event pipe
-//
-static void drainEmptyEvents(void)
-{
-    for (;;)
-    {
-        char dummy[64];
-        const ssize_t result = read(_glfw.x11.emptyEventPipe[0], dummy, sizeof(dummy));
-        if (result == -1 && errno != EINTR)
-            break;
-    }
-}
-
 // Waits until a VisibilityNotify event arrives for the specified window or the
 // timeout period elapses (ICCCM section 4.2.2)
 //
 static GLFWbool waitForVisibilityNotify(_GLFWwindow* window)
 {
     XEvent dummy;
-    double timeout = 0.1;
+    const uint64_t deadline = _glfwTimeoutToDeadlinePOSIX(0.1);
 
     while (!XCheckTypedWindowEvent(_glfw.x11.display,
                                    window->x11.handle,
                                    VisibilityNotify,
                                    &dummy))
     {
-        if (!waitForX11Event(&timeout))
+        if (!waitForX11Event(&deadline))
             return GLFW_FALSE;
     }
 
     return GLFW_TRUE;
 }
 
+// Maps the window and waits for it to become visible
+//
+static void mapWindow(_GLFWwindow* window)
+{
+    XMapWindow(_glfw.x11.display, window->x11.handle);
+    waitForVisibilityNotify(window);
+}
+
 // Returns whether the window is iconified
 //
 static int getWindowState(_GLFWwindow* window)
@@ -614,14 +657,8 @@ static GLFWbool createNativeWindow(_GLFWwindow* window,
                                        CWBorderPixel | CWColormap | CWEventMask,
                                        &wa);
 
-    _glfwReleaseErrorHandlerX11();
-
-    if (!window->x11.handle)
-    {
-        _glfwInputErrorX11(GLFW_PLATFORM_ERROR,
-                           "X11: Failed to create window");
-        return GLFW_FALSE;
-    }
+    // NOTE: The error handler stays installed while the initial properties are
+    //       set so that a single round trip covers all of these requests
 
     XSaveContext(_glfw.x11.display,
                  window->x11.handle,
@@ -696,6 +733,7 @@ static GLFWbool createNativeWindow(_GLFWwindow* window,
         XWMHints* hints = XAllocWMHints();
         if (!hints)
         {
+            _glfwReleaseErrorHandlerX11();
             _glfwInputError(GLFW_OUT_OF_MEMORY,
                             "X11: Failed to allocate WM hints");
             return GLFW_FALSE;
@@ -713,6 +751,7 @@ static GLFWbool createNativeWindow(_GLFWwindow* window,
         XSizeHints* hints = XAllocSizeHints();
         if (!hints)
         {
+            _glfwReleaseErrorHandlerX11();
             _glfwInputError(GLFW_OUT_OF_MEMORY, "X11: Failed to allocate size hints");
             return GLFW_FALSE;
         }
@@ -778,12 +817,26 @@ static GLFWbool createNativeWindow(_GLFWwindow* window,
                         PropModeReplace, (unsigned char*) &version, 1);
     }
 
+    _glfwReleaseErrorHandlerX11();
+
+    if (_glfw.x11.errorCode != Success)
+    {
+        _glfwInputErrorX11(GLFW_PLATFORM_ERROR,
+                           "X11: Failed to create window");
+        return GLFW_FALSE;
+    }
+
     if (_glfw.x11.im)
         _glfwCreateInputContextX11(window);
 
     _glfwSetWindowTitleX11(window, wndconfig->title);
-    _glfwGetWindowPosX11(window, &window->x11.xpos, &window->x11.ypos);
-    _glfwGetWindowSizeX11(window, &window->x11.width, &window->x11.height);
+
+    // The window is an unmapped child of the root window, so its position and
+    // size are still those it was created with
+    window->x11.xpos = xpos;
+    window->x11.ypos = ypos;
+    window->x11.width = width;
+    window->x11.height = height;
 
     return GLFW_TRUE;
 }
@@ -1142,6 +1195,40 @@ static void releaseMonitor(_GLFWwindow* window)
     }
 }
 
+// Returns the server time of the specified event as a timer value, or zero if
+// the event has no time
+//
+static uint64_t getEventTime(const XEvent* event)
+{
+    Time time;
+
+    switch (event->type)
+    {
+        case KeyPress:
+        case KeyRelease:
+            time = event->xkey.time;
+            break;
+        case ButtonPress:
+        case ButtonRelease:
+            time = event->xbutton.time;
+            break;
+        case MotionNotify:
+            time = event->xmotion.time;
+            break;
+        case EnterNotify:
+        case LeaveNotify:
+            time = event->xcrossing.time;
+            break;
+        default:
+            return 0;
+    }
+
+    if (time == CurrentTime)
+        return 0;
+
+    return _glfwMillisecondsToTimerValue((uint32_t) time);
+}
+
 // Process the specified X event
 //
 static void processEvent(XEvent *event)
@@ -1153,6 +1240,8 @@ static void processEvent(XEvent *event)
     if (event->type == KeyPress || event->type == KeyRelease)
         keycode = event->xkey.keycode;
 
+    _glfwInputEventTime(getEventTime(event));
+
     filtered = XFilterEvent(event, None);
 
     if (_glfw.x11.randr.available)
@@ -1198,6 +1287,12 @@ static void processEvent(XEvent *event)
                     double xpos = window->virtualCursorPosX;
                     double ypos = window->virtualCursorPosY;
 
+                    if (re->time != CurrentTime)
+                    {
+                        _glfwInputEventTime(
+                            _glfwMillisecondsToTimerValue((uint32_t) re->time));
+                    }
+
                     if (XIMaskIsSet(re->valuators.mask, 0))
                     {
                         xpos += *values;
@@ -1224,13 +1319,24 @@ static void processEvent(XEvent *event)
     }
 
     _GLFWwindow* window = NULL;
-    if (XFindContext(_glfw.x11.display,
-                     event->xany.window,
-                     _glfw.x11.context,
-                     (XPointer*) &window) != 0)
+    if (_glfw.x11.eventWindow &&
+        _glfw.x11.eventWindowHandle == event->xany.window)
     {
-        // This is an event for a window that has already been destroyed
-        return;
+        window = _glfw.x11.eventWindow;
+    }
+    else
+    {
+        if (XFindContext(_glfw.x11.display,
+                         event->xany.window,
+                         _glfw.x11.context,
+                         (XPointer*) &window) != 0)
+        {
+            // This is an event for a window that has already been destroyed
+            return;
+        }
+
+        _glfw.x11.eventWindowHandle = event->xany.window;
+        _glfw.x11.eventWindow = window;
     }
 
     switch (event->type)
@@ -2021,9 +2127,10 @@ GLFWbool _glfwCreateWindowX11(_GLFWwindow* window,
     if (wndconfig->mousePassthrough)
         _glfwSetWindowMousePassthroughX11(window, GLFW_TRUE);
 
+    // The new window is known to be unmapped, so skip the map state query
     if (window->monitor)
     {
-        _glfwShowWindowX11(window);
+        mapWindow(window);
         updateWindowMode(window);
         acquireMonitor(window);
 
@@ -2034,7 +2141,7 @@ GLFWbool _glfwCreateWindowX11(_GLFWwindow* window,
     {
         if (wndconfig->visible)
         {
-            _glfwShowWindowX11(window);
+            mapWindow(window);
             if (wndconfig->focused)
                 _glfwFocusWindowX11(window);
         }
@@ -2061,6 +2168,12 @@ void _glfwDestroyWindowX11(_GLFWwindow* window)
     if (window->context.destroy)
         window->context.destroy(window);
 
+    if (_glfw.x11.eventWindow == window)
+    {
+        _glfw.x11.eventWindowHandle = None;
+        _glfw.x11.eventWindow = NULL;
+    }
+
     if (window->x11.handle)
     {
         XDeleteContext(_glfw.x11.display, window->x11.handle, _glfw.x11.context);
@@ -2102,31 +2215,124 @@ void _glfwSetWindowTitleX11(_GLFWwindow* window, const char* title)
     XFlush(_glfw.x11.display);
 }
 
+// Returns whether the specified icon set matches the cached one
+//
+static GLFWbool isCachedIcon(int count, const GLFWimage* images,
+                             int longCount, uint64_t hash)
+{
+    if (!_glfw.x11.icon.data ||
+        _glfw.x11.icon.hash != hash ||
+        _glfw.x11.icon.count != count ||
+        _glfw.x11.icon.longCount != longCount)
+    {
+        return GLFW_FALSE;
+    }
+
+    const unsigned long* header = _glfw.x11.icon.data;
+    const unsigned char* pixels = _glfw.x11.icon.pixels;
+
+    for (int i = 0;  i < count;  i++)
+    {
+        const size_t size = (size_t) images[i].width * images[i].height * 4;
+
+        if (header[0] != (unsigned long) images[i].width ||
+            header[1] != (unsigned long) images[i].height ||
+            memcmp(pixels, images[i].pixels, size) != 0)
+        {
+            return GLFW_FALSE;
+        }
+
+        header += 2 + size / 4;
+        pixels += size;
+    }
+
+    return GLFW_TRUE;
+}
+
+// Converts an icon set to the _NET_WM_ICON property format
+//
+static unsigned long* convertIcon(int count, const GLFWimage* images, int longCount)
+{
+    unsigned long* icon = _glfw_calloc(longCount, sizeof(unsigned long));
+    unsigned long* target = icon;
+
+    for (int i = 0;  i < count;  i++)
+    {
+        const size_t pixelCount = (size_t) images[i].width * images[i].height;
+
+        *target++ = images[i].width;
+        *target++ = images[i].height;
+
+        // Convert in chunks small enough for the stack and then widen to the
+        // longs that _NET_WM_ICON uses, as those may not be 32-bit
+        for (size_t j = 0;  j < pixelCount;  j += 256)
+        {
+            uint32_t packed[256];
+            const size_t chunk = pixelCount - j < 256 ? pixelCount - j : 256;
+
+            _glfwConvertPixelsARGB(packed, images[i].pixels + j * 4, chunk, GLFW_FALSE);
+
+            for (size_t k = 0;  k < chunk;  k++)
+                *target++ = packed[k];
+        }
+    }
+
+    return icon;
+}
+
+// Makes the specified icon set and its converted data the cached icon
+//
+static void cacheIcon(int count, const GLFWimage* images,
+                      unsigned long* icon, int longCount, uint64_t hash)
+{
+    unsigned char* pixels = _glfw_calloc(longCount - count * 2, 4);
+    unsigned char* target = pixels;
+
+    for (int i = 0;  i < count;  i++)
+    {
+        const size_t size = (size_t) images[i].width * images[i].height * 4;
+        memcpy(target, images[i].pixels, size);
+        target += size;
+    }
+
+    _glfw_free(_glfw.x11.icon.data);
+    _glfw_free(_glfw.x11.icon.pixels);
+
+    _glfw.x11.icon.hash = hash;
+    _glfw.x11.icon.count = count;
+    _glfw.x11.icon.data = icon;
+    _glfw.x11.icon.longCount = longCount;
+    _glfw.x11.icon.pixels = pixels;
+}
+
 void _glfwSetWindowIconX11(_GLFWwindow* window, int count, const GLFWimage* images)
 {
     if (count)
     {
         int longCount = 0;
+        unsigned long* icon;
 
         for (int i = 0;  i < count;  i++)
             longCount += 2 + images[i].width * images[i].height;
 
-        unsigned long* icon = _glfw_calloc(longCount, sizeof(unsigned long));
-        unsigned long* target = icon;
-
-        for (int i = 0;  i < count;  i++)
+        if (_glfw.hints.init.imageCache)
         {
-            *target++ = images[i].width;
-            *target++ = images[i].height;
+            uint64_t hash = count;
+
+            for (int i = 0;  i < count;  i++)
+                hash = _glfwHashImage(images + i, hash);
 
-            for (int j = 0;  j < images[i].width * images[i].height;  j++)
+            // Applying the same icon set to many windows only converts it once
+            if (isCachedIcon(count, images, longCount, hash))
+                icon = _glfw.x11.icon.data;
+            else
             {
-                *target++ = (((unsigned long) images[i].pixels[j * 4 + 0]) << 16) |
-                            (((unsigned long) images[i].pixels[j * 4 + 1]) <<  8) |
-                            (((unsigned long) images[i].pixels[j * 4 + 2]) <<  0) |
-                            (((unsigned long) images[i].pixels[j * 4 + 3]) << 24);
+                icon = convertIcon(count, images, longCount);
+                cacheIcon(count, images, icon, longCount, hash);
             }
         }
+        else
+            icon = convertIcon(count, images, longCount);
 
         // NOTE: XChangeProperty expects 32-bit values like the image data above to be
         //       placed in the 32 least significant bits of individual longs.  This is
@@ -2141,7 +2347,8 @@ void _glfwSetWindowIconX11(_GLFWwindow* window, int count, const GLFWimage* imag
                         (unsigned char*) icon,
                         longCount);
 
-        _glfw_free(icon);
+        if (!_glfw.hints.init.imageCache)
+            _glfw_free(icon);
     }
     else
     {
@@ -2258,7 +2465,7 @@ void _glfwGetWindowFrameSizeX11(_GLFWwindow* window,
         _glfw.x11.NET_REQUEST_FRAME_EXTENTS)
     {
         XEvent event;
-        double timeout = 0.5;
+        const uint64_t deadline = _glfwTimeoutToDeadlinePOSIX(0.5);
 
         // Ensure _NET_FRAME_EXTENTS is set, allowing glfwGetWindowFrameSize to
         // function before the window is mapped
@@ -2275,7 +2482,7 @@ void _glfwGetWindowFrameSizeX11(_GLFWwindow* window,
                               isFrameExtentsEvent,
                               (XPointer) window))
         {
-            if (!waitForX11Event(&timeout))
+            if (!waitForX11Event(&deadline))
             {
                 _glfwInputError(GLFW_PLATFORM_ERROR,
                                 "X11: The window manager has a broken _NET_REQUEST_FRAME_EXTENTS implementation; please report this issue");
@@ -2430,8 +2637,7 @@ void _glfwShowWindowX11(_GLFWwindow* window)
     if (_glfwWindowVisibleX11(window))
         return;
 
-    XMapWindow(_glfw.x11.display, window->x11.handle);
-    waitForVisibilityNotify(window);
+    mapWindow(window);
 }
 
 void _glfwHideWindowX11(_GLFWwindow* window)
@@ -2781,11 +2987,13 @@ GLFWbool _glfwRawMouseMotionSupportedX11(void)
 
 void _glfwPollEventsX11(void)
 {
-    drainEmptyEvents();
+    // This makes no system calls when no empty event has been posted
+    if (__atomic_load_n(&_glfw.x11.emptyEventPosted, __ATOMIC_ACQUIRE))
+        drainEmptyEvents();
 
-#if defined(_GLFW_LINUX_JOYSTICK)
+#if defined(GLFW_BUILD_LINUX_JOYSTICK)
     if (_glfw.joysticksInitialized)
-        _glfwDetectJoystickConnectionLinux();
+        _glfwPollJoystickEventsLinux();
 #endif
     XPending(_glfw.x11.display);
 
@@ -2796,6 +3004,8 @@ void _glfwPollEventsX11(void)
         processEvent(&event);
     }
 
+    _glfwInputEventTime(0);
+
     _GLFWwindow* window = _glfw.x11.disabledCursorWindow;
     if (window)
     {
@@ -2822,7 +3032,14 @@ void _glfwWaitEventsX11(void)
 
 void _glfwWaitEventsTimeoutX11(double timeout)
 {
-    waitForAnyEvent(&timeout);
+    const uint64_t deadline = _glfwTimeoutToDeadlinePOSIX(timeout);
+    waitForAnyEvent(&deadline);
+    _glfwPollEventsX11();
+}
+
+void _glfwWaitEventsUntilX11(uint64_t timerValue)
+{
+    waitForAnyEvent(&timerValue);
     _glfwPollEventsX11();
 }
 
@@ -2944,6 +3161,51 @@ GLFWbool _glfwCreateCursorX11(_GLFWcursor* cursor,
     return GLFW_TRUE;
 }
 
+GLFWbool _glfwCreateAnimatedCursorX11(_GLFWcursor* cursor,
+                                      const GLFWimage* images,
+                                      int count,
+                                      const double* delays,
+                                      int xhot, int yhot)
+{
+    if (!_glfw.x11.xcursor.handle)
+        return GLFW_FALSE;
+
+    XcursorImages* native = XcursorImagesCreate(count);
+    if (native == NULL)
+        return GLFW_FALSE;
+
+    for (int i = 0;  i < count;  i++)
+    {
+        XcursorImage* image = XcursorImageCreate(images[i].width, images[i].height);
+        if (image == NULL)
+        {
+            XcursorImagesDestroy(native);
+            return GLFW_FALSE;
+        }
+
+        image->xhot = xhot;
+        image->yhot = yhot;
+        image->delay = (XcursorUInt) (delays[i] * 1000.0 + 0.5);
+        if (image->delay == 0)
+            image->delay = 1;
+
+        _glfwConvertPixelsARGB(image->pixels, images[i].pixels,
+                               (size_t) images[i].width * images[i].height,
+                               GLFW_TRUE);
+
+        native->images[native->nimage++] = image;
+    }
+
+    // The whole image set is uploaded once and the server steps through it
+    cursor->x11.handle = XcursorImagesLoadCursor(_glfw.x11.display, native);
+    XcursorImagesDestroy(native);
+
+    if (!cursor->x11.handle)
+        return GLFW_FALSE;
+
+    return GLFW_TRUE;
+}
+
 GLFWbool _glfwCreateStandardCursorX11(_GLFWcursor* cursor, int shape)
 {
     if (_glfw.x11.xcursor.handle)